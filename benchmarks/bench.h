@@ -242,11 +242,11 @@ template <typename T, typename... Ts> void fake_read(const T& x, const Ts&... mo
 
 #define MAKE_VECTORMATH_OVERLOAD(name)                                                   \
     template <class T, class... More, class VT = std::experimental::_VectorTraits<T>>    \
-    T hypot(T a, More... more)                                                           \
+    T name(T a, More... more)                                                            \
     {                                                                                    \
         T r;                                                                             \
         for (int i = 0; i < VT::_S_width; ++i) {                                         \
-            r[i] = std::hypot(a[i], more[i]...);                                         \
+            r[i] = std::name(a[i], more[i]...);                                          \
         }                                                                                \
         return r;                                                                        \
     }
@@ -0,0 +1,188 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "bench.h"
+
+struct Fpclassify {
+    static constexpr char name[] = "fpclassify";
+};
+struct Isnormal {
+    static constexpr char name[] = "isnormal  ";
+};
+struct Isfinite {
+    static constexpr char name[] = "isfinite  ";
+};
+
+template <class T> struct value_type {
+    using type = typename std::experimental::_VectorTraits<T>::value_type;
+};
+template <> struct value_type<float> {
+    using type = float;
+};
+template <> struct value_type<double> {
+    using type = double;
+};
+template <class T, class Abi> struct value_type<std::experimental::simd<T, Abi>> {
+    using type = T;
+};
+
+// lane i cycles through normal, subnormal, zero, infinity and NaN
+template <class T> T inputs()
+{
+    using U = typename value_type<T>::type;
+    using L = std::numeric_limits<U>;
+    const U values[5] = {1.5, L::denorm_min(), 0, L::infinity(), L::quiet_NaN()};
+    T r = T() + values[0];
+    if constexpr (size_v<T> > 1) {
+        for (int i = 0; i < size_v<T>; ++i) {
+            r[i] = values[i % 5];
+        }
+    }
+    return r;
+}
+template <> float inputs<float>() { return 1.5f; }
+template <> double inputs<double>() { return 1.5; }
+
+template <class What, class T> auto classify(const T& a)
+{
+    using std::experimental::fpclassify;
+    using std::experimental::isnormal;
+    using std::experimental::isfinite;
+    using std::fpclassify;
+    using std::isnormal;
+    using std::isfinite;
+    if constexpr (std::is_arithmetic_v<T> || std::experimental::is_simd_v<T>) {
+        if constexpr (std::is_same_v<What, Fpclassify>)
+            return fpclassify(a);
+        else if constexpr (std::is_same_v<What, Isnormal>)
+            return isnormal(a);
+        else
+            return isfinite(a);
+    } else {
+        using I = decltype(a < a);
+        I r = {};
+        for (int i = 0; i < size_v<T>; ++i) {
+            r[i] = classify<What>(a[i]);
+        }
+        return r;
+    }
+}
+
+template <class T> constexpr bool is_fixed_size_v = false;
+template <class T, int N>
+constexpr bool is_fixed_size_v<std::experimental::simd<T, std::experimental::simd_abi::fixed_size<N>>> =
+    true;
+
+// fixed_size_simd objects may not fit into a single register
+template <class T> void fake_modify_all(T& x)
+{
+    if constexpr (is_fixed_size_v<T>) {
+        std::experimental::__for_each(std::experimental::__data(x),
+                                      [](auto, auto& chunk) { fake_modify(chunk); });
+    } else {
+        fake_modify(x);
+    }
+}
+// fpclassify on simd returns a fixed_size_simd<int, N>
+template <class T> void fake_read_all(const T& x)
+{
+    if constexpr (is_fixed_size_v<T>) {
+        std::experimental::__for_each(std::experimental::__data(x),
+                                      [](auto, const auto& chunk) { fake_read(chunk); });
+    } else {
+        fake_read(x);
+    }
+}
+
+template <bool Latency, class T, class What> double benchmark()
+{
+    T a = inputs<T>();
+    return time_mean<10'000'000>([&]() {
+        fake_modify_all(a);
+        const auto r = classify<What>(a);
+        if constexpr (!Latency) {
+            fake_read_all(r);
+        } else if constexpr (std::is_same_v<What, Fpclassify>) {
+            // the product is zero and keeps the class of every lane
+            if constexpr (std::experimental::is_simd_v<T>)
+                a += std::experimental::static_simd_cast<T>(r) * 0;
+            else if constexpr (std::is_arithmetic_v<T>)
+                a += T(r) * 0;
+            else
+                a += __builtin_convertvector(r, T) * 0;
+        } else {
+            // flipping the sign keeps the class of every lane
+            if constexpr (std::experimental::is_simd_v<T>)
+                where(r, a) = -a;
+            else
+                a = r ? -a : a;
+        }
+    });
+}
+
+// fixed_size_simd combines native chunks with a scalar remainder
+template <class T, class What> void bench_fixed_size()
+{
+    using std::experimental::fixed_size_simd;
+    constexpr std::size_t N = 8 + 18 + 1 + sizeof(What::name);
+    char id[N];
+    std::memset(id, ' ', N - 1);
+    id[N - 1] = '\0';
+    std::strncpy(id + 18, "TYPE", 4);
+    print_header(id);
+    std::strncpy(id + 18, "    ", 4);
+    std::strncpy(id, std::is_same_v<T, float> ? " float," : "double,", 7);
+    std::strncpy(id + 8 + 18, What::name, sizeof(What::name) - 1);
+    const auto ref = bench_lat_thr<T, What>(id);
+    std::strncpy(id + 8, "fixed_size<3>     ", 18);
+    bench_lat_thr<fixed_size_simd<T, 3>, What>(id, ref);
+    std::strncpy(id + 8, "fixed_size<7>     ", 18);
+    bench_lat_thr<fixed_size_simd<T, 7>, What>(id, ref);
+    std::strncpy(id + 8, "fixed_size<13>    ", 18);
+    bench_lat_thr<fixed_size_simd<T, 13>, What>(id, ref);
+    char sep[N + 2 * 15 + 2 * 12];
+    std::memset(sep, '-', sizeof(sep) - 1);
+    sep[sizeof(sep) - 1] = '\0';
+    std::cout << sep << std::endl;
+}
+
+int main()
+{
+    bench_all<float, Fpclassify>();
+    bench_all<float, Isnormal>();
+    bench_all<float, Isfinite>();
+    bench_all<double, Fpclassify>();
+    bench_all<double, Isnormal>();
+    bench_all<double, Isfinite>();
+    bench_fixed_size<float, Fpclassify>();
+    bench_fixed_size<float, Isnormal>();
+    bench_fixed_size<float, Isfinite>();
+    bench_fixed_size<double, Fpclassify>();
+    bench_fixed_size<double, Isnormal>();
+    bench_fixed_size<double, Isfinite>();
+}
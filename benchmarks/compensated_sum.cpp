@@ -0,0 +1,121 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+// ways to accumulate float or double values
+struct Plain {
+    static constexpr char name[] = "plain      ";
+};
+struct Compensated {
+    static constexpr char name[] = "compensated";
+};
+struct Widened {
+    static constexpr char name[] = "in double  ";
+};
+
+// only simd types have compensated and widened accumulators; the others sum
+// plainly
+template <class T, class How> struct Accumulator {
+    T sum = T();
+    void operator+=(T x) { sum += x; }
+    void operator+=(const Accumulator& rhs) { sum += rhs.sum; }
+    T result() const { return sum; }
+};
+
+template <class T, class Abi> struct Accumulator<std::experimental::simd<T, Abi>, Compensated> {
+    std::experimental::__proposed::compensated_accumulator<std::experimental::simd<T, Abi>> acc;
+    void operator+=(std::experimental::simd<T, Abi> x) { acc += x; }
+    void operator+=(const Accumulator& rhs) { acc += rhs.acc; }
+    auto result() const { return acc.sum(); }
+};
+
+// the usual alternative to compensation: sum floats in double, i.e. with half
+// the lanes per register
+template <class Abi> struct Accumulator<std::experimental::simd<float, Abi>, Widened> {
+    using V = std::experimental::rebind_simd_t<double, std::experimental::simd<float, Abi>>;
+    V sum = V();
+    void operator+=(std::experimental::simd<float, Abi> x)
+    {
+        sum += std::experimental::static_simd_cast<V>(x);
+    }
+    void operator+=(const Accumulator& rhs) { sum += rhs.sum; }
+    auto result() const { return sum; }
+};
+
+template <class T> constexpr bool is_fixed_size_v = false;
+template <class T, int N>
+constexpr bool is_fixed_size_v<std::experimental::simd<T, std::experimental::simd_abi::fixed_size<N>>> =
+    true;
+
+// the double accumulator of a float simd may not fit into a single register
+template <class T> void fake_read_all(const T& x)
+{
+    if constexpr (is_fixed_size_v<T>) {
+        std::experimental::__for_each(std::experimental::__data(x),
+                                      [](auto, const auto& chunk) { fake_read(chunk); });
+    } else {
+        fake_read(x);
+    }
+}
+
+template <bool Latency, class T, class How> double benchmark()
+{
+    // every call sums 16 values: into one running sum that continues the sum
+    // of the previous call, or into four independent ones
+    constexpr int n = 16;
+    T a = T() + 1.1f;
+    Accumulator<T, How> carry;
+    return time_mean<1'000'000>([&]() {
+        Accumulator<T, How> acc0 = carry, acc1, acc2, acc3;
+        for (int i = 0; i < n; i += 4) {
+            T x0 = a, x1 = a, x2 = a, x3 = a;
+            fake_modify(x0, x1, x2, x3);
+            acc0 += x0;
+            (Latency ? acc0 : acc1) += x1;
+            (Latency ? acc0 : acc2) += x2;
+            (Latency ? acc0 : acc3) += x3;
+        }
+        if constexpr (Latency) {
+            carry = acc0;
+        } else {
+            acc0 += acc1;
+            acc2 += acc3;
+            acc0 += acc2;
+            fake_read_all(acc0.result());
+        }
+    }) / n;
+}
+
+int main()
+{
+    bench_all<float, Plain>();
+    bench_all<float, Compensated>();
+    bench_all<float, Widened>();
+    bench_all<double, Plain>();
+    bench_all<double, Compensated>();
+}
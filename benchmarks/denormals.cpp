@@ -0,0 +1,113 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+#include <limits>
+
+// input values
+struct Normal {
+    static constexpr char name[] = "normal   ";
+    template <class T> static constexpr T value = T(1.1);
+};
+struct Subnormal {
+    static constexpr char name[] = "subnormal";
+    template <class T> static constexpr T value = std::numeric_limits<T>::min() / 3;
+};
+
+// denormal handling of the FPU while the benchmark runs
+struct Ieee {
+    static constexpr char name[] = "ieee   ";
+};
+struct FtzDaz {
+    static constexpr char name[] = "ftz/daz";
+};
+
+template <class T> struct value_type {
+    using type = typename std::experimental::_VectorTraits<T>::value_type;
+};
+template <> struct value_type<float> {
+    using type = float;
+};
+template <> struct value_type<double> {
+    using type = double;
+};
+template <class T, class Abi> struct value_type<std::experimental::simd<T, Abi>> {
+    using type = T;
+};
+
+template <bool Latency, class T, class Input> double multiply()
+{
+    // every call does 16 multiplications by one: in a single chain that
+    // continues the chain of the previous call, or in four independent ones.
+    // Subnormal inputs stay subnormal, and every multiplication needs a
+    // microcode assist unless the FPU flushes them to zero.
+    using U = typename value_type<T>::type;
+    constexpr int n = 16;
+    T one = T() + U(1);
+    T carry = T() + Input::template value<U>;
+    return time_mean<1'000'000>([&]() {
+        fake_modify(one);
+        if constexpr (Latency) {
+            T x = carry;
+            for (int i = 0; i < n; ++i) {
+                x = x * one;
+            }
+            fake_read(x);
+            carry = x;
+        } else {
+            T x0 = carry, x1 = carry, x2 = carry, x3 = carry;
+            fake_modify(x0, x1, x2, x3);
+            for (int i = 0; i < n; i += 4) {
+                x0 = x0 * one;
+                x1 = x1 * one;
+                x2 = x2 * one;
+                x3 = x3 * one;
+            }
+            fake_read(x0, x1, x2, x3);
+        }
+    }) / n;
+}
+
+template <bool Latency, class T, class Input, class Mode> double benchmark()
+{
+    if constexpr (std::is_same_v<Mode, FtzDaz>) {
+        const std::experimental::__proposed::denormal_mode ftz_daz;
+        return multiply<Latency, T, Input>();
+    } else {
+        return multiply<Latency, T, Input>();
+    }
+}
+
+int main()
+{
+    bench_all<float, Normal, Ieee>();
+    bench_all<float, Subnormal, Ieee>();
+    bench_all<float, Subnormal, FtzDaz>();
+    bench_all<double, Normal, Ieee>();
+    bench_all<double, Subnormal, Ieee>();
+    bench_all<double, Subnormal, FtzDaz>();
+}
@@ -0,0 +1,64 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+struct Erf {
+    static constexpr char name[] = "Erf";
+};
+struct Erfc {
+    static constexpr char name[] = "Erfc";
+};
+
+MAKE_VECTORMATH_OVERLOAD(erf)
+MAKE_VECTORMATH_OVERLOAD(erfc)
+
+template <bool Latency, class T, class What> double benchmark()
+{
+    // the argument of erfc stays in the exp-based interval [1.25, 28)
+    T a = T() + (std::is_same_v<What, Erf> ? 0.5f : 1.5f);
+    return time_mean<5'000'000>([&]() {
+        fake_modify(a);
+        using ::erf;
+        using ::erfc;
+        using std::erf;
+        using std::erfc;
+        T r = std::is_same_v<What, Erf> ? erf(a) : erfc(a);
+        if constexpr (Latency)
+            a = r + (std::is_same_v<What, Erf> ? 0.f : 1.25f);
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, Erf>();
+    bench_all<float, Erfc>();
+    bench_all<double, Erf>();
+    bench_all<double, Erfc>();
+}
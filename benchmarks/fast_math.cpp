@@ -0,0 +1,161 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+struct Sin {
+    static constexpr char name[] = "sin";
+};
+struct Cos {
+    static constexpr char name[] = "cos";
+};
+struct Exp {
+    static constexpr char name[] = "exp";
+};
+struct Log {
+    static constexpr char name[] = "log";
+};
+struct Pow {
+    static constexpr char name[] = "pow";
+};
+
+// accuracy tiers
+struct Default {
+    static constexpr char name[] = "default  ";
+};
+struct Fast {
+    static constexpr char name[] = "fast_math";
+};
+
+MAKE_VECTORMATH_OVERLOAD(sin)
+MAKE_VECTORMATH_OVERLOAD(cos)
+MAKE_VECTORMATH_OVERLOAD(exp)
+MAKE_VECTORMATH_OVERLOAD(log)
+MAKE_VECTORMATH_OVERLOAD(pow)
+
+template <class What, class T> T call(T a, T b)
+{
+    using ::sin;
+    using ::cos;
+    using ::exp;
+    using ::log;
+    using ::pow;
+    using std::sin;
+    using std::cos;
+    using std::exp;
+    using std::log;
+    using std::pow;
+    if constexpr (std::is_same_v<What, Sin>)
+        return sin(a);
+    else if constexpr (std::is_same_v<What, Cos>)
+        return cos(a);
+    else if constexpr (std::is_same_v<What, Exp>)
+        return exp(a);
+    else if constexpr (std::is_same_v<What, Log>)
+        return log(a);
+    else
+        return pow(a, b);
+}
+
+// lane i is set to x0 + i * step
+template <class T> T lanes(float x0, float step)
+{
+    T r = T() + x0;
+    if constexpr (size_v<T> > 1) {
+        for (int i = 0; i < size_v<T>; ++i) {
+            r[i] = x0 + i * step;
+        }
+    }
+    return r;
+}
+
+template <bool Latency, class T, class What, class Tier> double benchmark()
+{
+    constexpr bool trig = std::is_same_v<What, Sin> || std::is_same_v<What, Cos>;
+    // the default sin and cos evaluate only one polynomial if all lanes share a
+    // quadrant; spread the lanes over all quadrants instead
+    const T offset = trig ? lanes<T>(0.5f, 0.8f) : T() + 0.5f;
+    T a = std::is_same_v<What, Log> || std::is_same_v<What, Pow> ? T() + 1.5f : offset;
+    T b = T() + 0.75f;
+    return time_mean<5'000'000>([&]() {
+        fake_modify(a, b);
+        T r;
+        // only simd types have fast_math overloads; the others measure std
+        if constexpr (std::is_same_v<Tier, Fast> && std::experimental::is_simd_v<T>) {
+            namespace fast = std::experimental::__proposed::fast_math;
+            if constexpr (std::is_same_v<What, Sin>)
+                r = fast::sin(a);
+            else if constexpr (std::is_same_v<What, Cos>)
+                r = fast::cos(a);
+            else if constexpr (std::is_same_v<What, Exp>)
+                r = fast::exp(a);
+            else if constexpr (std::is_same_v<What, Log>)
+                r = fast::log(a);
+            else
+                r = fast::pow(a, b);
+        } else {
+            r = call<What>(a, b);
+        }
+        if constexpr (Latency) {
+            // keep the argument inside the domain of the fast tier
+            if constexpr (std::is_same_v<What, Exp>)
+                a = r * 0.f + 0.5f;
+            else if constexpr (std::is_same_v<What, Log>)
+                a = r + 1.5f;
+            else if constexpr (std::is_same_v<What, Pow>)
+                a = r * 0.25f + 0.75f;
+            else
+                a = r + offset;
+        } else {
+            fake_read(r);
+        }
+    });
+}
+
+int main()
+{
+    bench_all<float, Sin, Default>();
+    bench_all<float, Sin, Fast>();
+    bench_all<float, Cos, Default>();
+    bench_all<float, Cos, Fast>();
+    bench_all<float, Exp, Default>();
+    bench_all<float, Exp, Fast>();
+    bench_all<float, Log, Default>();
+    bench_all<float, Log, Fast>();
+    bench_all<float, Pow, Default>();
+    bench_all<float, Pow, Fast>();
+    bench_all<double, Sin, Default>();
+    bench_all<double, Sin, Fast>();
+    bench_all<double, Cos, Default>();
+    bench_all<double, Cos, Fast>();
+    bench_all<double, Exp, Default>();
+    bench_all<double, Exp, Fast>();
+    bench_all<double, Log, Default>();
+    bench_all<double, Log, Fast>();
+    bench_all<double, Pow, Default>();
+    bench_all<double, Pow, Fast>();
+}
@@ -0,0 +1,483 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "bench.h"
+#include <array>
+
+// Every function tag names the function, computes it (y is only used by the
+// binary functions), and chooses the arguments: lane i of x is x0 + i * step
+// and all lanes of y are equal. In the latency benchmark the next x is
+// feedback * r + x0 + i * step; a feedback of 0 keeps r out of the value (to
+// stay in the domain and finite) but not out of the dependency chain.
+// Except for sin and cos all lanes are equal, so that all chunks take the same
+// branches. If the lanes of a fixed_size object need different branches, each
+// branch is evaluated for all chunks.
+
+struct Logb {
+    static constexpr char name[] = "logb     ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return logb(x);
+    }
+};
+
+struct Exp {
+    static constexpr char name[] = "exp      ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return exp(x);
+    }
+};
+
+struct Log {
+    static constexpr char name[] = "log      ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return log(x);
+    }
+};
+
+struct Sin {
+    static constexpr char name[] = "sin      ";
+    static constexpr float x0 = 0.5f, step = 0.8f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return sin(x);
+    }
+};
+
+struct Cos {
+    static constexpr char name[] = "cos      ";
+    static constexpr float x0 = 0.5f, step = 0.8f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return cos(x);
+    }
+};
+
+struct Exp2 {
+    static constexpr char name[] = "exp2     ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return exp2(x);
+    }
+};
+
+struct Expm1 {
+    static constexpr char name[] = "expm1    ";
+    static constexpr float x0 = 0.25f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return expm1(x);
+    }
+};
+
+struct Sinh {
+    static constexpr char name[] = "sinh     ";
+    static constexpr float x0 = 0.25f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return sinh(x);
+    }
+};
+
+struct Cosh {
+    static constexpr char name[] = "cosh     ";
+    static constexpr float x0 = 0.25f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return cosh(x);
+    }
+};
+
+struct Tanh {
+    static constexpr char name[] = "tanh     ";
+    static constexpr float x0 = 0.25f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return tanh(x);
+    }
+};
+
+struct Log1p {
+    static constexpr char name[] = "log1p    ";
+    static constexpr float x0 = 0.5f, step = 0.f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return log1p(x);
+    }
+};
+
+struct Asinh {
+    static constexpr char name[] = "asinh    ";
+    static constexpr float x0 = 0.5f, step = 0.f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return asinh(x);
+    }
+};
+
+struct Acosh {
+    static constexpr char name[] = "acosh    ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return acosh(x);
+    }
+};
+
+struct Atanh {
+    static constexpr char name[] = "atanh    ";
+    static constexpr float x0 = -0.75f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return atanh(x);
+    }
+};
+
+struct Atan {
+    static constexpr char name[] = "atan     ";
+    static constexpr float x0 = 0.5f, step = 0.f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return atan(x);
+    }
+};
+
+struct Atan2 {
+    static constexpr char name[] = "atan2    ";
+    static constexpr float x0 = 0.75f, step = 0.f, y = -0.5f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return atan2(x, y);
+    }
+};
+
+struct Asin {
+    static constexpr char name[] = "asin     ";
+    static constexpr float x0 = -0.75f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return asin(x);
+    }
+};
+
+struct Acos {
+    static constexpr char name[] = "acos     ";
+    static constexpr float x0 = -0.75f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return acos(x);
+    }
+};
+
+struct Cbrt {
+    static constexpr char name[] = "cbrt     ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.f, feedback = 1.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return cbrt(x);
+    }
+};
+
+struct Pow {
+    static constexpr char name[] = "pow      ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 2.5f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return pow(x, y);
+    }
+};
+
+struct Erf {
+    static constexpr char name[] = "erf      ";
+    static constexpr float x0 = -2.f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return erf(x);
+    }
+};
+
+struct Erfc {
+    static constexpr char name[] = "erfc     ";
+    static constexpr float x0 = -2.f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return erfc(x);
+    }
+};
+
+struct Lgamma {
+    static constexpr char name[] = "lgamma   ";
+    static constexpr float x0 = 0.5f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return lgamma(x);
+    }
+};
+
+struct Tgamma {
+    static constexpr char name[] = "tgamma   ";
+    static constexpr float x0 = 0.5f, step = 0.f, y = 0.f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return tgamma(x);
+    }
+};
+
+struct Fmod {
+    static constexpr char name[] = "fmod     ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.7f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return fmod(x, y);
+    }
+};
+
+struct Remainder {
+    static constexpr char name[] = "remainder";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.7f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        return remainder(x, y);
+    }
+};
+
+struct Remquo {
+    static constexpr char name[] = "remquo   ";
+    static constexpr float x0 = 1.5f, step = 0.f, y = 0.7f, feedback = 0.f;
+    template <class V> static V apply(const V& x, [[maybe_unused]] const V& y)
+    {
+        using namespace std::experimental;
+        fixed_size_simd<int, V::size()> quo;
+        const V r = remquo(x, y, &quo);
+        return r + static_simd_cast<V>(quo); // keep quo alive
+    }
+};
+
+constexpr int Chunks = 4;
+
+template <class T> using native_simd = std::experimental::native_simd<T>;
+template <class T>
+using fixed_simd = std::experimental::fixed_size_simd<T, Chunks * native_simd<T>::size()>;
+// the same number of values as fixed_simd<T>, as separate native objects
+template <class T> using native_array = std::array<native_simd<T>, Chunks>;
+
+template <class What, class V> V call(const V& a, const V& b)
+{
+    return What::apply(a, b);
+}
+
+template <class What, class V>
+std::array<V, Chunks> call(const std::array<V, Chunks>& a, const std::array<V, Chunks>& b)
+{
+    std::array<V, Chunks> r;
+    for (int i = 0; i < Chunks; ++i) {
+        r[i] = call<What>(a[i], b[i]);
+    }
+    return r;
+}
+
+// a fixed_size object is too large for a single register operand: pin every
+// native chunk instead
+template <class T> void fake_modify_all(fixed_simd<T>& x)
+{
+    std::experimental::__for_each(std::experimental::__data(x),
+                                  [](auto, auto& chunk) { fake_modify(chunk._M_data); });
+}
+template <class T> void fake_read_all(const fixed_simd<T>& x)
+{
+    std::experimental::__for_each(std::experimental::__data(x),
+                                  [](auto, const auto& chunk) { fake_read(chunk._M_data); });
+}
+template <class T> void fake_modify_all(native_array<T>& x)
+{
+    for (auto& v : x) {
+        fake_modify(v);
+    }
+}
+template <class T> void fake_read_all(const native_array<T>& x)
+{
+    for (const auto& v : x) {
+        fake_read(v);
+    }
+}
+
+// lane i is set to x0 + i * step
+template <class T> T lanes(float x0, float step)
+{
+    T r;
+    if constexpr (std::experimental::is_simd_v<T>) {
+        for (std::size_t i = 0; i < r.size(); ++i) {
+            r[i] = x0 + i * step;
+        }
+    } else {
+        for (std::size_t j = 0; j < r.size(); ++j) {
+            r[j] = lanes<typename T::value_type>(x0 + j * r[j].size() * step, step);
+        }
+    }
+    return r;
+}
+
+// the argument for the next call in the latency benchmark
+template <class What, class V> V next_argument(const V& r, const V& offset)
+{
+    return r * What::feedback + offset;
+}
+template <class What, class V>
+std::array<V, Chunks> next_argument(const std::array<V, Chunks>& r,
+                                    const std::array<V, Chunks>& offset)
+{
+    std::array<V, Chunks> a;
+    for (int i = 0; i < Chunks; ++i) {
+        a[i] = next_argument<What>(r[i], offset[i]);
+    }
+    return a;
+}
+
+template <bool Latency, class T, class What> double benchmark_chunks()
+{
+    const T offset = lanes<T>(What::x0, What::step);
+    T a = offset;
+    T b = lanes<T>(What::y, 0.f);
+    return time_mean<1'000'000>([&]() {
+        fake_modify_all(a);
+        fake_modify_all(b);
+        T r = call<What>(a, b);
+        if constexpr (Latency) {
+            a = next_argument<What>(r, offset);
+        } else {
+            fake_read_all(r);
+        }
+    });
+}
+
+template <class T, class What> void bench_chunks()
+{
+    const char* type = std::is_same_v<T, float> ? " float" : "double";
+    const double lat0 = benchmark_chunks<true, native_array<T>, What>();
+    const double thr0 = benchmark_chunks<false, native_array<T>, What>();
+    const double lat1 = benchmark_chunks<true, fixed_simd<T>, What>();
+    const double thr1 = benchmark_chunks<false, fixed_simd<T>, What>();
+    std::cout << type << ", " << What::name << ", " << Chunks << " × native_simd  "
+              << std::setprecision(3) << std::setw(15) << lat0 << std::setw(12) << ""
+              << std::setw(15) << thr0 << '\n';
+    std::cout << type << ", " << What::name << ", fixed_size<" << std::setw(2)
+              << fixed_simd<T>::size() << ">     " << std::setw(15) << lat1
+              << std::setw(12) << lat0 / lat1 << std::setw(15) << thr1 << std::setw(12)
+              << thr0 / thr1 << '\n';
+}
+
+int main()
+{
+    print_header("                                     ");
+    bench_chunks<float, Logb>();
+    bench_chunks<float, Exp>();
+    bench_chunks<float, Log>();
+    bench_chunks<float, Sin>();
+    bench_chunks<float, Cos>();
+    bench_chunks<float, Exp2>();
+    bench_chunks<float, Expm1>();
+    bench_chunks<float, Sinh>();
+    bench_chunks<float, Cosh>();
+    bench_chunks<float, Tanh>();
+    bench_chunks<float, Log1p>();
+    bench_chunks<float, Asinh>();
+    bench_chunks<float, Acosh>();
+    bench_chunks<float, Atanh>();
+    bench_chunks<float, Atan>();
+    bench_chunks<float, Atan2>();
+    bench_chunks<float, Asin>();
+    bench_chunks<float, Acos>();
+    bench_chunks<float, Cbrt>();
+    bench_chunks<float, Pow>();
+    bench_chunks<float, Erf>();
+    bench_chunks<float, Erfc>();
+    bench_chunks<float, Lgamma>();
+    bench_chunks<float, Tgamma>();
+    bench_chunks<float, Fmod>();
+    bench_chunks<float, Remainder>();
+    bench_chunks<float, Remquo>();
+    bench_chunks<double, Logb>();
+    bench_chunks<double, Exp>();
+    bench_chunks<double, Log>();
+    bench_chunks<double, Sin>();
+    bench_chunks<double, Cos>();
+    bench_chunks<double, Exp2>();
+    bench_chunks<double, Expm1>();
+    bench_chunks<double, Sinh>();
+    bench_chunks<double, Cosh>();
+    bench_chunks<double, Tanh>();
+    bench_chunks<double, Log1p>();
+    bench_chunks<double, Asinh>();
+    bench_chunks<double, Acosh>();
+    bench_chunks<double, Atanh>();
+    bench_chunks<double, Atan>();
+    bench_chunks<double, Atan2>();
+    bench_chunks<double, Asin>();
+    bench_chunks<double, Acos>();
+    bench_chunks<double, Cbrt>();
+    bench_chunks<double, Pow>();
+    bench_chunks<double, Erf>();
+    bench_chunks<double, Erfc>();
+    bench_chunks<double, Lgamma>();
+    bench_chunks<double, Tgamma>();
+    bench_chunks<double, Fmod>();
+    bench_chunks<double, Remainder>();
+    bench_chunks<double, Remquo>();
+}
@@ -0,0 +1,69 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+
+#include "bench.h"
+
+// implementations
+struct Fused {
+    static constexpr char name[] = "fma    ";
+};
+struct Separate {
+    static constexpr char name[] = "x*y + z";
+};
+
+MAKE_VECTORMATH_OVERLOAD(fma)
+
+template <bool Latency, class T, class How> double benchmark()
+{
+    T a = T() + 0x1.fe8222p-1f;
+    T b = T() + 0x1.82a4bcp-1f;
+    T c = T() + 0x1.f323e6p-2f;
+    return time_mean<10'000'000>([&]() {
+        using ::fma;
+        using std::fma;
+        using std::experimental::fma;
+        fake_modify(a, b, c);
+        T r;
+        if constexpr (std::is_same_v<How, Fused>)
+            r = fma(a, b, c);
+        else
+            r = a * b + c;
+        if constexpr (Latency)
+            c = r * 0.5f;
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, Fused>();
+    bench_all<float, Separate>();
+    bench_all<double, Fused>();
+    bench_all<double, Separate>();
+}
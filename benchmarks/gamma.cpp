@@ -0,0 +1,63 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#include "bench.h"
+
+struct Lgamma {
+    static constexpr char name[] = "Lgamma";
+};
+struct Tgamma {
+    static constexpr char name[] = "Tgamma";
+};
+
+MAKE_VECTORMATH_OVERLOAD(lgamma)
+MAKE_VECTORMATH_OVERLOAD(tgamma)
+
+template <bool Latency, class T, class What> double benchmark()
+{
+    // the argument stays in the recurrence range (-13, 13)
+    T a = T() + 4.5f;
+    return time_mean<5'000'000>([&]() {
+        fake_modify(a);
+        using ::lgamma;
+        using ::tgamma;
+        using std::lgamma;
+        using std::tgamma;
+        T r = std::is_same_v<What, Lgamma> ? lgamma(a) : tgamma(a);
+        if constexpr (Latency)
+            a = (r - r) + 4.5f;
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, Lgamma>();
+    bench_all<float, Tgamma>();
+    bench_all<double, Lgamma>();
+    bench_all<double, Tgamma>();
+}
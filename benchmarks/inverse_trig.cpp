@@ -0,0 +1,91 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+struct Atan {
+    static constexpr char name[] = "Atan";
+};
+struct Atan2 {
+    static constexpr char name[] = "Atan2";
+};
+struct Asin {
+    static constexpr char name[] = "Asin";
+};
+struct Acos {
+    static constexpr char name[] = "Acos";
+};
+
+MAKE_VECTORMATH_OVERLOAD(atan)
+MAKE_VECTORMATH_OVERLOAD(atan2)
+MAKE_VECTORMATH_OVERLOAD(asin)
+MAKE_VECTORMATH_OVERLOAD(acos)
+
+template <bool Latency, class T, class What> double benchmark()
+{
+    // a and b cover all branches of atan2 and the large argument branches of
+    // asin and acos
+    T a = T() + 0.75f;
+    T b = T() - 0.5f;
+    return time_mean<5'000'000>([&]() {
+        fake_modify(a, b);
+        using ::atan;
+        using ::atan2;
+        using ::asin;
+        using ::acos;
+        using std::atan;
+        using std::atan2;
+        using std::asin;
+        using std::acos;
+        T r;
+        if constexpr (std::is_same_v<What, Atan>) {
+            r = atan(a);
+        } else if constexpr (std::is_same_v<What, Atan2>) {
+            r = atan2(a, b);
+        } else if constexpr (std::is_same_v<What, Asin>) {
+            r = asin(a);
+        } else {
+            r = acos(a);
+        }
+        if constexpr (Latency)
+            a = r * 0.25f; // stay within the domain of asin and acos
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, Atan>();
+    bench_all<float, Atan2>();
+    bench_all<float, Asin>();
+    bench_all<float, Acos>();
+    bench_all<double, Atan>();
+    bench_all<double, Atan2>();
+    bench_all<double, Asin>();
+    bench_all<double, Acos>();
+}
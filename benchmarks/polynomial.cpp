@@ -0,0 +1,110 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+struct Horner {
+    static constexpr char name[] = "horner";
+};
+struct Estrin {
+    static constexpr char name[] = "estrin";
+};
+
+// number of coefficients
+struct N4 {
+    static constexpr char name[] = "n = 4 ";
+    static constexpr std::size_t value = 4;
+};
+struct N8 {
+    static constexpr char name[] = "n = 8 ";
+    static constexpr std::size_t value = 8;
+};
+struct N16 {
+    static constexpr char name[] = "n = 16";
+    static constexpr std::size_t value = 16;
+};
+
+template <class T> struct value_type {
+    using type = typename std::experimental::_VectorTraits<T>::value_type;
+};
+template <> struct value_type<float> {
+    using type = float;
+};
+template <> struct value_type<double> {
+    using type = double;
+};
+template <class T, class Abi> struct value_type<std::experimental::simd<T, Abi>> {
+    using type = T;
+};
+
+// the Taylor series of exp, truncated after N terms
+template <class Scheme, class T, std::size_t... Is> T exp_series(T x, std::index_sequence<Is...>)
+{
+    constexpr double c[] = {1.,           1.,           1. / 2,        1. / 6,
+                            1. / 24,      1. / 120,     1. / 720,      1. / 5040,
+                            1. / 40320,   1. / 362880,  1. / 3628800,  1. / 39916800,
+                            1. / 479001600, 1. / 6227020800, 1. / 87178291200,
+                            1. / 1307674368000};
+    if constexpr (std::experimental::is_simd_v<T>) {
+        using namespace std::experimental::__proposed;
+        return polynomial<std::conditional_t<std::is_same_v<Scheme, Horner>, horner, estrin>>(
+            x, c[Is]...);
+    } else {
+        // the other types only measure Horner
+        using U = typename value_type<T>::type;
+        T r = T() + U(c[sizeof...(Is) - 1]);
+        for (int i = sizeof...(Is) - 2; i >= 0; --i) {
+            r = r * x + U(c[i]);
+        }
+        return r;
+    }
+}
+
+template <bool Latency, class T, class Scheme, class N> double benchmark()
+{
+    T a = T() + 0.5f;
+    return time_mean<10'000'000>([&]() {
+        fake_modify(a);
+        const T r = exp_series<Scheme>(a, std::make_index_sequence<N::value>());
+        if constexpr (Latency)
+            a = r * 0.f + 0.5f;
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, Horner, N4>();
+    bench_all<float, Estrin, N4>();
+    bench_all<float, Horner, N8>();
+    bench_all<float, Estrin, N8>();
+    bench_all<double, Horner, N8>();
+    bench_all<double, Estrin, N8>();
+    bench_all<double, Horner, N16>();
+    bench_all<double, Estrin, N16>();
+}
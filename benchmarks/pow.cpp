@@ -0,0 +1,68 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+struct Pow {
+    static constexpr char name[] = "Pow";
+};
+struct Square {
+    static constexpr char name[] = "Pow(x, 2)";
+};
+struct Sqrt {
+    static constexpr char name[] = "Pow(x, .5)";
+};
+
+MAKE_VECTORMATH_OVERLOAD(pow)
+
+template <bool Latency, class T, class What> double benchmark()
+{
+    T a = T() + 1.5f;
+    // a uniform exponent selects the repeated squaring and sqrt fast paths
+    T b = T() + (std::is_same_v<What, Pow> ? -0.75f
+                 : std::is_same_v<What, Square> ? 2.f : 0.5f);
+    return time_mean<5'000'000>([&]() {
+        fake_modify(a, b);
+        using ::pow;
+        using std::pow;
+        T r = pow(a, b);
+        if constexpr (Latency)
+            a = r * 0.25f + 0.75f; // stay positive and finite
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, Pow>();
+    bench_all<float, Square>();
+    bench_all<float, Sqrt>();
+    bench_all<double, Pow>();
+    bench_all<double, Square>();
+    bench_all<double, Sqrt>();
+}
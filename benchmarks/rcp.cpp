@@ -0,0 +1,85 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+struct Rcp {
+    static constexpr char name[] = "1/x    ";
+};
+struct Rsqrt {
+    static constexpr char name[] = "1/sqrt ";
+};
+
+// implementations
+struct Divide {
+    static constexpr char name[] = "divide  ";
+};
+struct Newton {
+    static constexpr char name[] = "estimate";
+};
+
+MAKE_VECTORMATH_OVERLOAD(sqrt)
+
+template <bool Latency, class T, class What, class How> double benchmark()
+{
+    T a = T() + 3.5f;
+    return time_mean<10'000'000>([&]() {
+        using ::sqrt;
+        using std::sqrt;
+        fake_modify(a);
+        T r;
+        // only simd types have rcp and rsqrt; the others measure the division
+        if constexpr (std::is_same_v<How, Newton> && std::experimental::is_simd_v<T>) {
+            using namespace std::experimental::__proposed;
+            if constexpr (std::is_same_v<What, Rcp>)
+                r = rcp(a);
+            else
+                r = rsqrt(a);
+        } else {
+            if constexpr (std::is_same_v<What, Rcp>)
+                r = 1 / a;
+            else
+                r = 1 / sqrt(a);
+        }
+        if constexpr (Latency)
+            a = r + 3.f;
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, Rcp, Divide>();
+    bench_all<float, Rcp, Newton>();
+    bench_all<float, Rsqrt, Divide>();
+    bench_all<float, Rsqrt, Newton>();
+    bench_all<double, Rcp, Divide>();
+    bench_all<double, Rcp, Newton>();
+    bench_all<double, Rsqrt, Divide>();
+    bench_all<double, Rsqrt, Newton>();
+}
@@ -33,31 +33,77 @@ struct Sine {
 struct Cosine {
     static constexpr char name[] = "Cosine";
 };
+struct SinCos {
+    static constexpr char name[] = "SinCos";
+};
+
+// argument ranges
+struct Small {
+    static constexpr char name[] = "x = 2";
+};
+struct Medium {
+    static constexpr char name[] = "x ~ 100";
+};
+struct Large {
+    static constexpr char name[] = "x ~ 1e6";
+};
 
 MAKE_VECTORMATH_OVERLOAD(sin)
 MAKE_VECTORMATH_OVERLOAD(cos)
 
-template <bool Latency, class T, class What> double benchmark()
+// reference for the builtin and vector builtin types: separate sin and cos
+template <class T> std::pair<T, T> sincos(T a)
+{
+    using ::sin;
+    using ::cos;
+    using std::sin;
+    using std::cos;
+    return {sin(a), cos(a)};
+}
+
+template <bool Latency, class T, class What, class Arg> double benchmark()
 {
-    T a = T() + 2;
+    // larger arguments need a longer range reduction
+    constexpr float offset = std::is_same_v<Arg, Large>    ? 1e6f
+                             : std::is_same_v<Arg, Medium> ? 100.f
+                                                           : 0.f;
+    T a = T() + (offset + 2);
     return time_mean<5'000'000>([&]() {
         fake_modify(a);
         using ::sin;
         using ::cos;
         using std::sin;
         using std::cos;
-        T r = std::is_same_v<What, Sine> ? sin(a) : cos(a);
-        if constexpr (Latency)
-            a = r;
-        else
-            fake_read(r);
+        using ::sincos;
+        using std::experimental::__proposed::sincos;
+        if constexpr (std::is_same_v<What, SinCos>) {
+            const auto [s, c] = sincos(a);
+            if constexpr (Latency)
+                a = s + c + offset;
+            else
+                fake_read(s, c);
+        } else {
+            T r = std::is_same_v<What, Sine> ? sin(a) : cos(a);
+            if constexpr (Latency)
+                a = r + offset;
+            else
+                fake_read(r);
+        }
     });
 }
 
 int main()
 {
-    bench_all<float, Sine>();
-    bench_all<float, Cosine>();
-    bench_all<double, Sine>();
-    bench_all<double, Cosine>();
+    bench_all<float, Sine, Small>();
+    bench_all<float, Sine, Medium>();
+    bench_all<float, Sine, Large>();
+    bench_all<float, Cosine, Small>();
+    bench_all<float, Cosine, Medium>();
+    bench_all<float, Cosine, Large>();
+    bench_all<float, SinCos, Small>();
+    bench_all<float, SinCos, Medium>();
+    bench_all<float, SinCos, Large>();
+    bench_all<double, Sine, Small>();
+    bench_all<double, Cosine, Small>();
+    bench_all<double, SinCos, Small>();
 }
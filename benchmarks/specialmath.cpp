@@ -0,0 +1,91 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2019 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "bench.h"
+
+struct BesselJ {
+    static constexpr char name[] = "cyl_bessel_j(0, x)";
+};
+struct BesselI {
+    static constexpr char name[] = "cyl_bessel_i(1, x)";
+};
+struct EllintK {
+    static constexpr char name[] = "comp_ellint_1";
+};
+struct EllintE {
+    static constexpr char name[] = "comp_ellint_2";
+};
+
+MAKE_VECTORMATH_OVERLOAD(cyl_bessel_j)
+MAKE_VECTORMATH_OVERLOAD(cyl_bessel_i)
+MAKE_VECTORMATH_OVERLOAD(comp_ellint_1)
+MAKE_VECTORMATH_OVERLOAD(comp_ellint_2)
+
+template <bool Latency, class T, class What> double benchmark()
+{
+    constexpr bool bessel = std::is_same_v<What, BesselJ> || std::is_same_v<What, BesselI>;
+    // Bessel: throughput measures a polynomial interval (x = 2.5), latency the
+    // Hankel expansion (x = 10)
+    T a = T() + (bessel ? 2.5f : 0.5f);
+    T nu = T() + (std::is_same_v<What, BesselJ> ? 0.f : 1.f);
+    return time_mean<5'000'000>([&]() {
+        fake_modify(a, nu);
+        using ::cyl_bessel_j;
+        using ::cyl_bessel_i;
+        using ::comp_ellint_1;
+        using ::comp_ellint_2;
+        using std::cyl_bessel_j;
+        using std::cyl_bessel_i;
+        using std::comp_ellint_1;
+        using std::comp_ellint_2;
+        T r;
+        if constexpr (std::is_same_v<What, BesselJ>)
+            r = cyl_bessel_j(nu, a);
+        else if constexpr (std::is_same_v<What, BesselI>)
+            r = cyl_bessel_i(nu, a);
+        else if constexpr (std::is_same_v<What, EllintK>)
+            r = comp_ellint_1(a);
+        else
+            r = comp_ellint_2(a);
+        if constexpr (Latency)
+            a = r * 0.f + (bessel ? 10.f : 0.75f); // keep the argument domain
+        else
+            fake_read(r);
+    });
+}
+
+int main()
+{
+    bench_all<float, BesselJ>();
+    bench_all<float, BesselI>();
+    bench_all<float, EllintK>();
+    bench_all<float, EllintE>();
+    bench_all<double, BesselJ>();
+    bench_all<double, BesselI>();
+    bench_all<double, EllintK>();
+    bench_all<double, EllintE>();
+}
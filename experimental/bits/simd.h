@@ -4400,6 +4400,9 @@ template <int _Bytes, class _Abi> struct _MixinImplicitMasking {
             })
                             : ~_ImplicitMask<_Tp>());
 
+    // The elements past size() of a partial register are zero: __masked and
+    // zero-extension produce zeros, which never take a subnormal (or NaN)
+    // slow path in operations on the full register.
     template <class _Tp, class _TVT = _VectorTraits<_Tp>>
     static constexpr auto __masked(_Tp __x)
     {
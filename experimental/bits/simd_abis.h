@@ -841,6 +841,39 @@ _GLIBCXX_SIMD_INTRINSIC auto __cmpunord(_Tp __x, _Tp __y)
     }
 }
 
+// }}}
+// __cmplessgreater{{{
+// (__x < __y) | (__x > __y) without raising FE_INVALID on quiet NaNs
+template <class _Tp, class _TVT = _VectorTraits<_Tp>>
+_GLIBCXX_SIMD_INTRINSIC auto __cmplessgreater(_Tp __x, _Tp __y)
+{
+  static_assert(is_floating_point_v<typename _TVT::value_type>);
+#if _GLIBCXX_SIMD_X86INTRIN // {{{
+  if constexpr (__have_avx && _TVT::template __is<float, 4>)
+    return __intrin_bitcast<_Tp>(_mm_cmp_ps(__x, __y, _CMP_NEQ_OQ));
+  else if constexpr (__have_avx && _TVT::template __is<double, 2>)
+    return __intrin_bitcast<_Tp>(_mm_cmp_pd(__x, __y, _CMP_NEQ_OQ));
+  else if constexpr (__have_sse && _TVT::template __is<float, 4>)
+    return __intrin_bitcast<_Tp>(
+      _mm_and_ps(_mm_cmpneq_ps(__x, __y), _mm_cmpord_ps(__x, __y)));
+  else if constexpr (__have_sse2 && _TVT::template __is<double, 2>)
+    return __intrin_bitcast<_Tp>(
+      _mm_and_pd(_mm_cmpneq_pd(__x, __y), _mm_cmpord_pd(__x, __y)));
+  else if constexpr (__have_avx && _TVT::template __is<float, 8>)
+    return __intrin_bitcast<_Tp>(_mm256_cmp_ps(__x, __y, _CMP_NEQ_OQ));
+  else if constexpr (__have_avx && _TVT::template __is<double, 4>)
+    return __intrin_bitcast<_Tp>(_mm256_cmp_pd(__x, __y, _CMP_NEQ_OQ));
+  else if constexpr (__have_avx512f && _TVT::template __is<float, 16>)
+    return _mm512_cmp_ps_mask(__x, __y, _CMP_NEQ_OQ);
+  else if constexpr (__have_avx512f && _TVT::template __is<double, 8>)
+    return _mm512_cmp_pd_mask(__x, __y, _CMP_NEQ_OQ);
+  else
+#endif // _GLIBCXX_SIMD_X86INTRIN }}}
+    {
+      return reinterpret_cast<_Tp>((__x < __y) | (__x > __y));
+    }
+}
+
 // }}}
 // __maskstore (non-converting; with optimizations for SSE2-AVX512BWVL) {{{
 #if _GLIBCXX_SIMD_X86INTRIN // {{{
@@ -1339,7 +1372,9 @@ _GLIBCXX_SIMD_INTRINSIC auto __convert_all(_From __v)
 #if _GLIBCXX_SIMD_X86INTRIN // {{{
   else if constexpr (!__have_sse4_1 &&
 		     !(sizeof(typename _FromVT::value_type) == 4 &&
-		       is_same_v<typename _ToVT::value_type, double>))
+		       (is_same_v<typename _ToVT::value_type, double> ||
+			(is_same_v<typename _FromVT::value_type, float> &&
+			 sizeof(typename _ToVT::value_type) == 8))))
     {
       using _ToT   = typename _ToVT::value_type;
       using _FromT = typename _FromVT::value_type;
@@ -2176,9 +2211,7 @@ template <class _Abi> struct _SimdMathFallback {  //{{{
   _GLIBCXX_SIMD_MATH_FALLBACK(log2)
   _GLIBCXX_SIMD_MATH_FALLBACK(logb)
 
-  //modf implemented in simd_math.h
-  _GLIBCXX_SIMD_MATH_FALLBACK(scalbn)
-  _GLIBCXX_SIMD_MATH_FALLBACK(scalbln)
+  //modf, scalbn and scalbln implemented in simd_math.h
   _GLIBCXX_SIMD_MATH_FALLBACK(cbrt)
   _GLIBCXX_SIMD_MATH_FALLBACK(abs)
   _GLIBCXX_SIMD_MATH_FALLBACK(fabs)
@@ -2225,6 +2258,22 @@ template <class _Abi> struct _SimdMathFallback {  //{{{
   _GLIBCXX_SIMD_MATH_FALLBACK(fma)
   _GLIBCXX_SIMD_MATH_FALLBACK_FIXEDRET(int, fpclassify)
 
+  // special math; cyl_bessel_i, cyl_bessel_j, comp_ellint_1, and
+  // comp_ellint_2 are vectorized in simd_math.h for some arguments
+  _GLIBCXX_SIMD_MATH_FALLBACK(beta)
+  _GLIBCXX_SIMD_MATH_FALLBACK(comp_ellint_1)
+  _GLIBCXX_SIMD_MATH_FALLBACK(comp_ellint_2)
+  _GLIBCXX_SIMD_MATH_FALLBACK(comp_ellint_3)
+  _GLIBCXX_SIMD_MATH_FALLBACK(cyl_bessel_i)
+  _GLIBCXX_SIMD_MATH_FALLBACK(cyl_bessel_j)
+  _GLIBCXX_SIMD_MATH_FALLBACK(cyl_bessel_k)
+  _GLIBCXX_SIMD_MATH_FALLBACK(cyl_neumann)
+  _GLIBCXX_SIMD_MATH_FALLBACK(ellint_1)
+  _GLIBCXX_SIMD_MATH_FALLBACK(ellint_2)
+  _GLIBCXX_SIMD_MATH_FALLBACK(ellint_3)
+  _GLIBCXX_SIMD_MATH_FALLBACK(expint)
+  _GLIBCXX_SIMD_MATH_FALLBACK(riemann_zeta)
+
   template <class _Tp>
   _GLIBCXX_SIMD_INTRINSIC simd_mask<_Tp, _Abi>
 			  __isfinite(const simd<_Tp, _Abi>& __x)
@@ -2288,7 +2337,10 @@ template <class _Abi> struct _SimdMathFallback {  //{{{
   _GLIBCXX_SIMD_INTRINSIC static constexpr auto
     __islessgreater(const _Tp& __x, const _Tp& __y)
   {
-    return __or(_SuperImpl::__less(__y, __x), _SuperImpl::__less(__x, __y));
+    if constexpr (__is_vector_type_v<_Tp>)
+      return __cmplessgreater(__x, __y);
+    else
+      return __cmplessgreater(__x._M_data, __y._M_data);
   }
 
   template <typename _Tp, typename _TVT = _VectorTraits<_Tp>>
@@ -2503,7 +2555,16 @@ struct _SimdImplScalar : _SimdMathFallback<simd_abi::scalar> {
 
     template <class _Tp> _GLIBCXX_SIMD_INTRINSIC static _SimdTuple<int, abi_type> __fpclassify(_Tp __x)
     {
-        return {std::fpclassify(__x)};
+        // std::fpclassify branches on the class. Instead, count the class
+        // boundaries below the bit pattern of |__x|:
+        // zero < subnormal < min <= normal < inf < NaN
+        using _I = __int_for_sizeof_t<_Tp>;
+        static constexpr int __classes[5] = {FP_ZERO, FP_SUBNORMAL, FP_NORMAL,
+                                             FP_INFINITE, FP_NAN};
+        const _I __min = __bit_cast<_I>(std::numeric_limits<_Tp>::min());
+        const _I __inf = __bit_cast<_I>(std::numeric_limits<_Tp>::infinity());
+        const _I __xi = __bit_cast<_I>(__x) & std::numeric_limits<_I>::max();
+        return {__classes[(__xi != 0) + (__xi >= __min) + (__xi >= __inf) + (__xi > __inf)]};
     }
     template <class _Tp> _GLIBCXX_SIMD_INTRINSIC static bool __isfinite(_Tp __x) { return std::isfinite(__x); }
     template <class _Tp> _GLIBCXX_SIMD_INTRINSIC static bool __isinf(_Tp __x) { return std::isinf(__x); }
@@ -2511,6 +2572,7 @@ struct _SimdImplScalar : _SimdMathFallback<simd_abi::scalar> {
     template <class _Tp> _GLIBCXX_SIMD_INTRINSIC static bool __isnormal(_Tp __x) { return std::isnormal(__x); }
     template <class _Tp> _GLIBCXX_SIMD_INTRINSIC static bool __signbit(_Tp __x) { return std::signbit(__x); }
     template <class _Tp> _GLIBCXX_SIMD_INTRINSIC static bool __isunordered(_Tp __x, _Tp __y) { return std::isunordered(__x, __y); }
+    template <class _Tp> _GLIBCXX_SIMD_INTRINSIC static bool __islessgreater(_Tp __x, _Tp __y) { return std::islessgreater(__x, __y); }
 
     // __increment & __decrement{{{2
     template <class _Tp> static inline void __increment(_Tp &__x) { ++__x; }
@@ -2651,6 +2713,19 @@ template <class _Tp, size_t _N> constexpr bool __is_avx512_pd()
     return __have_avx512f && std::is_same_v<_Tp, double> && _N == 8;
 }
 
+// whether ==, <, and > on vectors of _N integers of sizeof(_Tp) compile to a
+// single instruction yielding a vector mask: 64-bit compares need SSE4.1
+// (pcmpeqq) and SSE4.2 (pcmpgtq), 256-bit compares need AVX2, and AVX-512
+// compares yield bitmasks
+template <class _Tp, size_t _N> constexpr bool __is_int_compare_native()
+{
+    if constexpr (!__have_sse2)
+        return true;
+    else
+        return (sizeof(_Tp) < 8 || __have_sse4_2) &&
+               (sizeof(_Tp) * _N <= 16 || (__have_avx2 && sizeof(_Tp) * _N <= 32));
+}
+
 template <class _Tp, size_t _N> constexpr bool __is_neon_ps()
 {
     return __have_neon && std::is_same_v<_Tp, float> && _N == 4;
@@ -3198,6 +3273,145 @@ template <class _Abi> struct _SimdImplBuiltin : _SimdMathFallback<_Abi> {
 		  __andnot(__inv_mask, __y + __vector_broadcast<_N, _Tp>(1)));
     }
 
+    // __fmin, __fmax {{{3
+    // `a < b ? a : b` is minps/minpd on x86; it returns b if either is NaN,
+    // so only a NaN in b needs fixing up
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static _SimdWrapper<_Tp, _N>
+      __fmin(_SimdWrapper<_Tp, _N> __a, _SimdWrapper<_Tp, _N> __b)
+    {
+      const auto __r = __a._M_data < __b._M_data ? __a._M_data : __b._M_data;
+#if __FINITE_MATH_ONLY__
+      return __r;
+#else
+      return __b._M_data == __b._M_data ? __r : __a._M_data;
+#endif
+    }
+
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static _SimdWrapper<_Tp, _N>
+      __fmax(_SimdWrapper<_Tp, _N> __a, _SimdWrapper<_Tp, _N> __b)
+    {
+      const auto __r = __a._M_data > __b._M_data ? __a._M_data : __b._M_data;
+#if __FINITE_MATH_ONLY__
+      return __r;
+#else
+      return __b._M_data == __b._M_data ? __r : __a._M_data;
+#endif
+    }
+
+    // __fdim {{{3
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static _SimdWrapper<_Tp, _N>
+      __fdim(_SimdWrapper<_Tp, _N> __x, _SimdWrapper<_Tp, _N> __y)
+    {
+      // NaN compares false and propagates through the subtraction
+      return __x._M_data <= __y._M_data ? __vector_type_t<_Tp, _N>()
+					: __x._M_data - __y._M_data;
+    }
+
+    // __nextafter {{{3
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static _SimdWrapper<_Tp, _N>
+      __nextafter(_SimdWrapper<_Tp, _N> __x, _SimdWrapper<_Tp, _N> __y)
+    {
+      using _V   = __vector_type_t<_Tp, _N>;
+      using _I   = __int_for_sizeof_t<_Tp>;
+      const _V __xx = __x._M_data;
+      const _V __yy = __y._M_data;
+      const auto __xi = __vector_bitcast<_I>(__xx);
+      const auto __yi = __vector_bitcast<_I>(__yy);
+      // the magnitude grows (-(-1)) if x < y differs from x < 0, else it
+      // shrinks (-1); ±max steps to ±inf and ±inf to ±max
+      auto __r = __xi - (__vector_bitcast<_I>((__xx < __yy) ^ (__xx < _V())) | 1);
+      // from ±0 the next value is the smallest subnormal with the sign of y
+      __r = __vector_bitcast<_I>(__xx == _V())
+	      ? (__yi & __vector_bitcast<_I>(_S_signmask<_V>)) | 1
+	      : __r;
+      __r = __vector_bitcast<_I>(__xx == __yy) ? __yi : __r;
+#if __FINITE_MATH_ONLY__
+      return __vector_bitcast<_Tp>(__r);
+#else
+      return __vector_bitcast<_I>(__xx == __xx) & __vector_bitcast<_I>(__yy == __yy)
+	       ? __vector_bitcast<_Tp>(__r)
+	       : __xx + __yy;
+#endif
+    }
+
+    // __lrint, __llrint, __lround, __llround {{{3
+    // Converts the integral values in __x to the fixed_size storage of _R.
+    // NaN and out-of-range values are replaced by the exactly representable
+    // -2^(digits of _R), which yields the minimum of _R as the x86 cvt
+    // instructions (and thus glibc) do.
+    template <class _R, class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<_R, _N>
+      __convert_integral(_SimdWrapper<_Tp, _N> __x)
+    {
+      constexpr _Tp __bound = -_Tp(std::numeric_limits<_R>::min());
+      const _SimdWrapper<_Tp, _N> __clamped =
+	_SuperImpl::__abs(__x)._M_data < __bound
+	  ? __x._M_data
+	  : __vector_broadcast<_N>(-__bound);
+      return _SimdConverter<_Tp, _Abi, _R, simd_abi::fixed_size<_N>>()(
+	__clamped);
+    }
+
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<long, _N>
+      __lrint(_SimdWrapper<_Tp, _N> __x)
+    {
+      return __convert_integral<long>(
+	_SimdWrapper<_Tp, _N>(_SuperImpl::__rint(__x)));
+    }
+
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<long long, _N>
+      __llrint(_SimdWrapper<_Tp, _N> __x)
+    {
+      return __convert_integral<long long>(
+	_SimdWrapper<_Tp, _N>(_SuperImpl::__rint(__x)));
+    }
+
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<long, _N>
+      __lround(_SimdWrapper<_Tp, _N> __x)
+    {
+      return __convert_integral<long>(_SuperImpl::__round(__x));
+    }
+
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<long long, _N>
+      __llround(_SimdWrapper<_Tp, _N> __x)
+    {
+      return __convert_integral<long long>(_SuperImpl::__round(__x));
+    }
+
+    // __ilogb {{{3
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<int, _N>
+      __ilogb(_SimdWrapper<_Tp, _N> __x)
+    {
+      using _V      = __vector_type_t<_Tp, _N>;
+      using _I      = __int_for_sizeof_t<_Tp>;
+      using _Limits = std::numeric_limits<_Tp>;
+      constexpr int __mant_bits = _Limits::digits - 1;
+      const auto __inf = __vector_bitcast<_I>(_V() + _Limits::infinity());
+      const auto __xi  = __vector_bitcast<_I>(__and(__x._M_data, _S_absmask<_V>));
+      // subnormals are normalized by scaling with 2^__mant_bits
+      const auto __subnormal =
+	__xi < __vector_bitcast<_I>(_V() + _Limits::min());
+      const auto __xn = __subnormal ? __vector_bitcast<_I>(
+			  __vector_bitcast<_Tp>(__xi) * _Tp(1ull << __mant_bits))
+				    : __xi;
+      auto __e = (__xn >> __mant_bits) - (_Limits::max_exponent - 1)
+		 - (__vector_bitcast<_I>(__subnormal) & __mant_bits);
+      __e = __xi == 0 ? _I() + FP_ILOGB0 : __e;
+      __e = __xi == __inf ? _I() + std::numeric_limits<int>::max() : __e;
+      __e = __xi > __inf ? _I() + FP_ILOGBNAN : __e;
+      return _SimdConverter<_I, _Abi, int, simd_abi::fixed_size<_N>>()(
+	_SimdWrapper<_I, _N>(__e));
+    }
+
     // __isnan {{{3
     template <class _Tp, size_t _N>
     _GLIBCXX_SIMD_INTRINSIC static _MaskMember<_Tp> __isnan(_SimdWrapper<_Tp, _N> __x)
@@ -3252,18 +3466,18 @@ template <class _Abi> struct _SimdImplBuiltin : _SimdMathFallback<_Abi> {
       __unused(__x);
       return {}; // false
 #else
-      return _SuperImpl::template __equal_to<_Tp, _N>(
-	_SuperImpl::__abs(__x),
-	__vector_broadcast<_N>(std::numeric_limits<_Tp>::infinity()));
-      // alternative:
-      // compare to inf using the corresponding integer type
-      /*
-	 return
-	 __vector_bitcast<_Tp>(__vector_bitcast<__int_for_sizeof_t<_Tp>>(__abs(__x)._M_data)
-	 ==
-	 __vector_bitcast<__int_for_sizeof_t<_Tp>>(__vector_broadcast<_N>(
-	 std::numeric_limits<_Tp>::infinity())));
-	 */
+      if constexpr (__is_int_compare_native<_Tp, _N>())
+	{ // compare to inf using the corresponding integer type
+	  using _I = __int_for_sizeof_t<_Tp>;
+	  const auto __inf = __vector_bitcast<_I>(
+	    __vector_broadcast<_N>(std::numeric_limits<_Tp>::infinity()));
+	  return __vector_bitcast<_Tp>(
+	    __vector_bitcast<_I>(_SuperImpl::__abs(__x)._M_data) == __inf);
+	}
+      else
+	return _SuperImpl::template __equal_to<_Tp, _N>(
+	  _SuperImpl::__abs(__x),
+	  __vector_broadcast<_N>(std::numeric_limits<_Tp>::infinity()));
 #endif
     }
 
@@ -3272,40 +3486,78 @@ template <class _Abi> struct _SimdImplBuiltin : _SimdMathFallback<_Abi> {
     _GLIBCXX_SIMD_INTRINSIC static _MaskMember<_Tp>
       __isnormal(_SimdWrapper<_Tp, _N> __x)
     {
+      if constexpr (__is_int_compare_native<_Tp, _N>())
+	{ // min <= |__x| < inf, compared as integers
+	  using _I = __int_for_sizeof_t<_Tp>;
+	  using _U = std::make_unsigned_t<_I>;
+	  const auto __min = __vector_bitcast<_U>(
+	    __vector_broadcast<_N>(std::numeric_limits<_Tp>::min()));
+	  const auto __xu = __vector_bitcast<_U>(_SuperImpl::__abs(__x)._M_data);
 #if __FINITE_MATH_ONLY__
-      return _SuperImpl::template __less_equal<_Tp, _N>(
-	__vector_broadcast<_N>(std::numeric_limits<_Tp>::min()), _SuperImpl::__abs(__x));
+	  return __vector_bitcast<_Tp>(__vector_bitcast<_I>(__xu) >=
+				       __vector_bitcast<_I>(__min));
 #else
-      return __and(
-	_SuperImpl::template __less_equal<_Tp, _N>(
-	  __vector_broadcast<_N>(std::numeric_limits<_Tp>::min()), _SuperImpl::__abs(__x)),
-	_SuperImpl::template __less<_Tp, _N>(
-	  _SuperImpl::__abs(__x),
-	  __vector_broadcast<_N>(std::numeric_limits<_Tp>::infinity())));
+	  // Adding min increments the exponent field, which wraps inf and NaN
+	  // to negative values. Thus a single signed compare remains.
+	  return __vector_bitcast<_Tp>(__vector_bitcast<_I>(__xu + __min) >
+				       __vector_bitcast<_I>(__min + __min - 1));
 #endif
+	}
+      else
+	{
+#if __FINITE_MATH_ONLY__
+	  return _SuperImpl::template __less_equal<_Tp, _N>(
+	    __vector_broadcast<_N>(std::numeric_limits<_Tp>::min()),
+	    _SuperImpl::__abs(__x));
+#else
+	  return __and(
+	    _SuperImpl::template __less_equal<_Tp, _N>(
+	      __vector_broadcast<_N>(std::numeric_limits<_Tp>::min()),
+	      _SuperImpl::__abs(__x)),
+	    _SuperImpl::template __less<_Tp, _N>(
+	      _SuperImpl::__abs(__x),
+	      __vector_broadcast<_N>(std::numeric_limits<_Tp>::infinity())));
+#endif
+	}
     }
 
     // __fpclassify {{{3
     template <class _Tp, size_t _N>
     _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<int, _N> __fpclassify(_SimdWrapper<_Tp, _N> __x)
     {
-      constexpr auto __fp_normal = __vector_bitcast<_Tp>(
-	__vector_broadcast<_N, __int_for_sizeof_t<_Tp>>(FP_NORMAL));
-      constexpr auto __fp_nan = __vector_bitcast<_Tp>(
-	__vector_broadcast<_N, __int_for_sizeof_t<_Tp>>(FP_NAN));
-      constexpr auto __fp_infinite = __vector_bitcast<_Tp>(
-	__vector_broadcast<_N, __int_for_sizeof_t<_Tp>>(FP_INFINITE));
-      constexpr auto __fp_subnormal = __vector_bitcast<_Tp>(
-	__vector_broadcast<_N, __int_for_sizeof_t<_Tp>>(FP_SUBNORMAL));
-      constexpr auto __fp_zero = __vector_bitcast<_Tp>(
-	__vector_broadcast<_N, __int_for_sizeof_t<_Tp>>(FP_ZERO));
-
-      const auto __tmp = __vector_bitcast<_LLong>(
-	_SuperImpl::__abs(__x)._M_data < std::numeric_limits<_Tp>::min()
-	  ? (__x._M_data == 0 ? __fp_zero : __fp_subnormal)
-	  : __blend(__isinf(__x)._M_data,
-		    __blend(__isnan(__x)._M_data, __fp_normal, __fp_nan),
-		    __fp_infinite));
+      using _V = __vector_type_t<_Tp, _N>;
+      using _I = __int_for_sizeof_t<_Tp>;
+      using _Limits = std::numeric_limits<_Tp>;
+      constexpr auto __fp_normal = __vector_broadcast<_N, _I>(FP_NORMAL);
+      constexpr auto __fp_nan = __vector_broadcast<_N, _I>(FP_NAN);
+      constexpr auto __fp_infinite = __vector_broadcast<_N, _I>(FP_INFINITE);
+      constexpr auto __fp_subnormal = __vector_broadcast<_N, _I>(FP_SUBNORMAL);
+      constexpr auto __fp_zero = __vector_broadcast<_N, _I>(FP_ZERO);
+
+      const auto __tmp = __vector_bitcast<_LLong>([&] {
+	if constexpr (__is_int_compare_native<_Tp, _N>())
+	  {
+	    // As integers, the bit patterns of |__x| order the classes:
+	    // zero < subnormal < min <= normal < inf < NaN
+	    const auto __min = __vector_bitcast<_I>(_V() + _Limits::min());
+	    const auto __inf = __vector_bitcast<_I>(_V() + _Limits::infinity());
+	    const auto __xi
+	      = __vector_bitcast<_I>(__and(__x._M_data, _S_absmask<_V>));
+	    return __xi < __min ? (__xi == 0 ? __fp_zero : __fp_subnormal)
+		   : __xi < __inf ? __fp_normal
+		   : __xi == __inf ? __fp_infinite : __fp_nan;
+	  }
+	else
+	  return __vector_bitcast<_I>(
+	    _SuperImpl::__abs(__x)._M_data < _Limits::min()
+	      ? (__x._M_data == 0 ? __vector_bitcast<_Tp>(__fp_zero)
+				  : __vector_bitcast<_Tp>(__fp_subnormal))
+	      : __blend(__isinf(__x)._M_data,
+			__blend(__isnan(__x)._M_data,
+				__vector_bitcast<_Tp>(__fp_normal),
+				__vector_bitcast<_Tp>(__fp_nan)),
+			__vector_bitcast<_Tp>(__fp_infinite)));
+      }());
       if constexpr (sizeof(_Tp) == sizeof(int))
 	{
 	  if constexpr (__fixed_size_storage_t<int, _N>::_S_tuple_size == 1)
@@ -4567,7 +4819,7 @@ template <class _Abi> struct __x86_simd_impl : _SimdImplBuiltin<_Abi> {
     {
       if constexpr (sizeof(__x) == 64)
 	{ // AVX512
-	  constexpr auto __k1 = _Abi::template __implicit_mask<_Tp>();
+	  constexpr auto __k1 = _Abi::template _S_implicit_mask<_Tp>;
 	  [[maybe_unused]] const auto __xi = __to_intrin(__x);
 	  [[maybe_unused]] const auto __yi = __to_intrin(__y);
 	  if constexpr (std::is_same_v<_Tp, float>)
@@ -4805,6 +5057,74 @@ template <class _Abi> struct __x86_simd_impl : _SimdImplBuiltin<_Abi> {
         }
     }
 
+    // __fma {{{3
+    // without FMA3 or FMA4 simd_math.h emulates fma and only calls this for
+    // the corner cases
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static _SimdWrapper<_Tp, _N>
+      __fma(_SimdWrapper<_Tp, _N> __x, _SimdWrapper<_Tp, _N> __y,
+	    _SimdWrapper<_Tp, _N> __z)
+    {
+      if constexpr (__have_fma) {
+               if constexpr (__is_sse_ps   <_Tp, _N>()) { return _mm_fmadd_ps(__x, __y, __z);
+        } else if constexpr (__is_sse_pd   <_Tp, _N>()) { return _mm_fmadd_pd(__x, __y, __z);
+        } else if constexpr (__is_avx_ps   <_Tp, _N>()) { return _mm256_fmadd_ps(__x, __y, __z);
+        } else if constexpr (__is_avx_pd   <_Tp, _N>()) { return _mm256_fmadd_pd(__x, __y, __z);
+        } else if constexpr (__is_avx512_ps<_Tp, _N>()) { return _mm512_fmadd_ps(__x, __y, __z);
+        } else if constexpr (__is_avx512_pd<_Tp, _N>()) { return _mm512_fmadd_pd(__x, __y, __z);
+        } else { return _Base::__fma(__x, __y, __z); }
+      } else if constexpr (__have_fma4) {
+               if constexpr (__is_sse_ps   <_Tp, _N>()) { return _mm_macc_ps(__x, __y, __z);
+        } else if constexpr (__is_sse_pd   <_Tp, _N>()) { return _mm_macc_pd(__x, __y, __z);
+        } else if constexpr (__is_avx_ps   <_Tp, _N>()) { return _mm256_macc_ps(__x, __y, __z);
+        } else if constexpr (__is_avx_pd   <_Tp, _N>()) { return _mm256_macc_pd(__x, __y, __z);
+        } else { return _Base::__fma(__x, __y, __z); }
+      } else {
+        return _Base::__fma(__x, __y, __z);
+      }
+    }
+
+    // __fmin, __fmax {{{3
+    // min/max return the second operand if either one is NaN. Passing __a
+    // second leaves only a NaN in __a to fix up.
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static _SimdWrapper<_Tp, _N>
+      __fmin(_SimdWrapper<_Tp, _N> __a, _SimdWrapper<_Tp, _N> __b)
+    {
+      __vector_type_t<_Tp, _N> __r;
+             if constexpr (__is_sse_ps   <_Tp, _N>()) { __r = _mm_min_ps(__b, __a);
+        } else if constexpr (__is_sse_pd   <_Tp, _N>()) { __r = _mm_min_pd(__b, __a);
+        } else if constexpr (__is_avx_ps   <_Tp, _N>()) { __r = _mm256_min_ps(__b, __a);
+        } else if constexpr (__is_avx_pd   <_Tp, _N>()) { __r = _mm256_min_pd(__b, __a);
+        } else if constexpr (__is_avx512_ps<_Tp, _N>()) { __r = _mm512_min_ps(__b, __a);
+        } else if constexpr (__is_avx512_pd<_Tp, _N>()) { __r = _mm512_min_pd(__b, __a);
+        } else { return _Base::__fmin(__a, __b); }
+#if __FINITE_MATH_ONLY__
+      return __r;
+#else
+      return __blend(__cmpunord(__a._M_data, __a._M_data), __r, __b._M_data);
+#endif
+    }
+
+    template <class _Tp, size_t _N>
+    _GLIBCXX_SIMD_INTRINSIC static _SimdWrapper<_Tp, _N>
+      __fmax(_SimdWrapper<_Tp, _N> __a, _SimdWrapper<_Tp, _N> __b)
+    {
+      __vector_type_t<_Tp, _N> __r;
+             if constexpr (__is_sse_ps   <_Tp, _N>()) { __r = _mm_max_ps(__b, __a);
+        } else if constexpr (__is_sse_pd   <_Tp, _N>()) { __r = _mm_max_pd(__b, __a);
+        } else if constexpr (__is_avx_ps   <_Tp, _N>()) { __r = _mm256_max_ps(__b, __a);
+        } else if constexpr (__is_avx_pd   <_Tp, _N>()) { __r = _mm256_max_pd(__b, __a);
+        } else if constexpr (__is_avx512_ps<_Tp, _N>()) { __r = _mm512_max_ps(__b, __a);
+        } else if constexpr (__is_avx512_pd<_Tp, _N>()) { __r = _mm512_max_pd(__b, __a);
+        } else { return _Base::__fmax(__a, __b); }
+#if __FINITE_MATH_ONLY__
+      return __r;
+#else
+      return __blend(__cmpunord(__a._M_data, __a._M_data), __r, __b._M_data);
+#endif
+    }
+
     // __signbit {{{3
     template <class _Tp, size_t _N>
     _GLIBCXX_SIMD_INTRINSIC static _MaskMember<_Tp> __signbit(_SimdWrapper<_Tp, _N> __x)
@@ -4927,7 +5247,27 @@ template <class _Abi> struct __x86_simd_impl : _SimdImplBuiltin<_Abi> {
       __unused(__x);
       return __equal_to(_SimdWrapper<_Tp, _N>(), _SimdWrapper<_Tp, _N>());
 #else
-      return __cmpord(__x._M_data, __x._M_data * _Tp());
+      // 0x99: QNaN | +Inf | -Inf | SNaN
+      if constexpr (__have_avx512dq_vl && __is_sse_ps<_Tp, _N>())
+	return __vector_bitcast<float>(
+	  _mm_movm_epi32(_knot_mask8(_mm_fpclass_ps_mask(__x, 0x99))));
+      else if constexpr (__have_avx512dq_vl && __is_avx_ps<_Tp, _N>())
+	return __vector_bitcast<float>(
+	  _mm256_movm_epi32(_knot_mask8(_mm256_fpclass_ps_mask(__x, 0x99))));
+      else if constexpr (__have_avx512dq && __is_avx512_ps<_Tp, _N>())
+	return _knot_mask16(_mm512_fpclass_ps_mask(__x, 0x99));
+      else if constexpr (__have_avx512dq_vl && __is_sse_pd<_Tp, _N>())
+	return __vector_bitcast<double>(
+	  _mm_movm_epi64(_knot_mask8(_mm_fpclass_pd_mask(__x, 0x99))));
+      else if constexpr (__have_avx512dq_vl && __is_avx_pd<_Tp, _N>())
+	return __vector_bitcast<double>(
+	  _mm256_movm_epi64(_knot_mask8(_mm256_fpclass_pd_mask(__x, 0x99))));
+      else if constexpr (__have_avx512dq && __is_avx512_pd<_Tp, _N>())
+	return _knot_mask8(_mm512_fpclass_pd_mask(__x, 0x99));
+      else if constexpr (__is_int_compare_native<_Tp, _N>())
+	return _Base::__isfinite(__x);
+      else
+	return __cmpord(__x._M_data, __x._M_data * _Tp());
 #endif
     }
 
@@ -4970,27 +5310,22 @@ template <class _Abi> struct __x86_simd_impl : _SimdImplBuiltin<_Abi> {
     _GLIBCXX_SIMD_INTRINSIC static _MaskMember<_Tp>
       __isnormal(_SimdWrapper<_Tp, _N> __x)
     {
-      if constexpr (__have_avx512dq)
-	{
-	  if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>())
-	    return __vector_bitcast<float>(
-	      _mm_movm_epi32(_knot_mask8(_mm_fpclass_ps_mask(__x, 0xbf))));
-	  else if constexpr (__have_avx512vl && __is_avx_ps<_Tp, _N>())
-	    return __vector_bitcast<float>(_mm256_movm_epi32(
-	      _knot_mask8(_mm256_fpclass_ps_mask(__x, 0xbf))));
-	  else if constexpr (__is_avx512_ps<_Tp, _N>())
-	    return _knot_mask16(_mm512_fpclass_ps_mask(__x, 0xbf));
-	  else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>())
-	    return __vector_bitcast<double>(
-	      _mm_movm_epi64(_knot_mask8(_mm_fpclass_pd_mask(__x, 0xbf))));
-	  else if constexpr (__have_avx512vl && __is_avx_pd<_Tp, _N>())
-	    return __vector_bitcast<double>(_mm256_movm_epi64(
-	      _knot_mask8(_mm256_fpclass_pd_mask(__x, 0xbf))));
-	  else if constexpr (__is_avx512_pd<_Tp, _N>())
-	    return _knot_mask8(_mm512_fpclass_pd_mask(__x, 0xbf));
-	  else
-	    __assert_unreachable<_Tp>();
-	}
+      if constexpr (__have_avx512dq_vl && __is_sse_ps<_Tp, _N>())
+	return __vector_bitcast<float>(
+	  _mm_movm_epi32(_knot_mask8(_mm_fpclass_ps_mask(__x, 0xbf))));
+      else if constexpr (__have_avx512dq_vl && __is_avx_ps<_Tp, _N>())
+	return __vector_bitcast<float>(
+	  _mm256_movm_epi32(_knot_mask8(_mm256_fpclass_ps_mask(__x, 0xbf))));
+      else if constexpr (__have_avx512dq && __is_avx512_ps<_Tp, _N>())
+	return _knot_mask16(_mm512_fpclass_ps_mask(__x, 0xbf));
+      else if constexpr (__have_avx512dq_vl && __is_sse_pd<_Tp, _N>())
+	return __vector_bitcast<double>(
+	  _mm_movm_epi64(_knot_mask8(_mm_fpclass_pd_mask(__x, 0xbf))));
+      else if constexpr (__have_avx512dq_vl && __is_avx_pd<_Tp, _N>())
+	return __vector_bitcast<double>(
+	  _mm256_movm_epi64(_knot_mask8(_mm256_fpclass_pd_mask(__x, 0xbf))));
+      else if constexpr (__have_avx512dq && __is_avx512_pd<_Tp, _N>())
+	return _knot_mask8(_mm512_fpclass_pd_mask(__x, 0xbf));
       else
 	return _Base::__isnormal(__x);
     }
@@ -5002,7 +5337,29 @@ template <class _Abi> struct __x86_simd_impl : _SimdImplBuiltin<_Abi> {
     template <class _Tp, size_t _N>
     _GLIBCXX_SIMD_INTRINSIC static __fixed_size_storage_t<int, _N> __fpclassify(_SimdWrapper<_Tp, _N> __x)
     {
-        if constexpr (__is_avx512_pd<_Tp, _N>()) {
+        if constexpr (__have_avx512dq && __is_avx512_ps<_Tp, _N>()) {
+            // vfpclassps tests for each class directly: 0x81 NaN, 0x18 inf,
+            // 0x06 zero, 0x20 subnormal
+            auto &&__b = [](int __y) { return __to_intrin(__vector_broadcast<_N>(__y)); };
+            return {_mm512_mask_mov_epi32(
+                _mm512_mask_mov_epi32(
+                    _mm512_mask_mov_epi32(
+                        _mm512_mask_mov_epi32(__b(FP_NORMAL), _mm512_fpclass_ps_mask(__x, 0x81),
+                                              __b(FP_NAN)),
+                        _mm512_fpclass_ps_mask(__x, 0x18), __b(FP_INFINITE)),
+                    _mm512_fpclass_ps_mask(__x, 0x06), __b(FP_ZERO)),
+                _mm512_fpclass_ps_mask(__x, 0x20), __b(FP_SUBNORMAL))};
+        } else if constexpr (__have_avx512dq_vl && __is_avx512_pd<_Tp, _N>()) {
+            auto &&__b = [](int __y) { return __to_intrin(__vector_broadcast<_N>(__y)); };
+            return {_mm256_mask_mov_epi32(
+                _mm256_mask_mov_epi32(
+                    _mm256_mask_mov_epi32(
+                        _mm256_mask_mov_epi32(__b(FP_NORMAL), _mm512_fpclass_pd_mask(__x, 0x81),
+                                              __b(FP_NAN)),
+                        _mm512_fpclass_pd_mask(__x, 0x18), __b(FP_INFINITE)),
+                    _mm512_fpclass_pd_mask(__x, 0x06), __b(FP_ZERO)),
+                _mm512_fpclass_pd_mask(__x, 0x20), __b(FP_SUBNORMAL))};
+        } else if constexpr (__is_avx512_pd<_Tp, _N>()) {
             // AVX512 is special because we want to use an __mmask to blend int vectors
             // (coming from double vectors). GCC doesn't allow this combination on the
             // ternary operator. Thus, resort to intrinsics:
@@ -6072,8 +6429,6 @@ public:
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, log2)
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, logb)
     //modf implemented in simd_math.h
-    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, scalbn) //double scalbn(double x, int exp);
-    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, scalbln)
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, cbrt)
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, abs)
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, fabs)
@@ -6106,6 +6461,19 @@ public:
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, fmin)
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, fma)
     _GLIBCXX_SIMD_APPLY_ON_TUPLE(int, fpclassify)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, beta)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, comp_ellint_1)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, comp_ellint_2)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, comp_ellint_3)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, cyl_bessel_i)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, cyl_bessel_j)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, cyl_bessel_k)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, cyl_neumann)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, ellint_1)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, ellint_2)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, ellint_3)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, expint)
+    _GLIBCXX_SIMD_APPLY_ON_TUPLE(_Tp, riemann_zeta)
 #undef _GLIBCXX_SIMD_APPLY_ON_TUPLE
 
     template <typename _Tp, typename... _Abis>
@@ -6116,7 +6484,12 @@ public:
     {
       return __x.__apply_per_chunk(
 	[](auto __impl, const auto __xx, const auto __yy, auto& __zz) {
-	  return __impl.__remquo(__xx, __yy, &__zz);
+	  using _V = typename decltype(__impl)::simd_type;
+	  fixed_size_simd<int, _V::size()> __quo;
+	  const auto __r = __data(remquo(_V(__private_init, __xx),
+					 _V(__private_init, __yy), &__quo));
+	  __zz = __data(__quo);
+	  return __r;
 	},
 	__y, *__z);
     }
@@ -6145,8 +6518,8 @@ public:
 
 #define _GLIBCXX_SIMD_TEST_ON_TUPLE_(name_)                                    \
   template <typename _Tp, typename... _As>                                     \
-  static inline _MaskMember __##name_(                                   \
-    const _SimdTuple<_Tp, _As...>& __x) noexcept                             \
+  _GLIBCXX_SIMD_INTRINSIC static _MaskMember __##name_(                        \
+    const _SimdTuple<_Tp, _As...>& __x) noexcept                               \
   {                                                                            \
     return __test([](auto __impl, auto __xx) { return __impl.__##name_(__xx); }, \
 		__x);                                                          \
@@ -6237,9 +6610,10 @@ public:
 
     // __masked_cassign {{{2
     template <template <typename> class _Op, typename _Tp, typename... _As>
-    static inline void __masked_cassign(const _MaskMember          __bits,
-					_SimdTuple<_Tp, _As...>&       __lhs,
-					const _SimdTuple<_Tp, _As...>& __rhs)
+    _GLIBCXX_SIMD_INTRINSIC static void
+    __masked_cassign(const _MaskMember              __bits,
+		     _SimdTuple<_Tp, _As...>&       __lhs,
+		     const _SimdTuple<_Tp, _As...>& __rhs)
     {
       __for_each(__lhs, __rhs,
 		 [&](auto __meta, auto& __native_lhs, auto __native_rhs) constexpr {
@@ -6251,9 +6625,10 @@ public:
     // Optimization for the case where the RHS is a scalar. No need to broadcast
     // the scalar to a simd first.
     template <template <typename> class _Op, typename _Tp, typename... _As>
-    static inline void __masked_cassign(const _MaskMember    __bits,
-					_SimdTuple<_Tp, _As...>& __lhs,
-					const _Tp&                 __rhs)
+    _GLIBCXX_SIMD_INTRINSIC static void
+    __masked_cassign(const _MaskMember        __bits,
+		     _SimdTuple<_Tp, _As...>& __lhs,
+		     const _Tp&               __rhs)
     {
       __for_each(__lhs, [&](auto __meta, auto& __native_lhs) constexpr {
 	__meta.template __masked_cassign<_Op>(__meta.__make_mask(__bits),
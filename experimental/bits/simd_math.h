@@ -50,14 +50,37 @@ template <class _Tp, class _Abi> struct __math_return_type<bool, _Tp, _Abi> {
 template <class _DoubleR, class _Tp, class _Abi> struct __math_return_type {
     using type = std::experimental::fixed_size_simd<_DoubleR, simd_size_v<_Tp, _Abi>>;
 };
+//}}}
+// __math_per_chunk {{{
+/**\internal
+ * Whether a math function with a vector algorithm forwards \p _Abi to
+ * `_Abi::_SimdImpl` instead of running the algorithm itself: always for
+ * scalar, and for fixed_size if it stores a single chunk.
+ *
+ * `_SimdImplFixedSize` evaluates the function for one native chunk after the
+ * other. If there are several chunks, the vector algorithm on the fixed_size
+ * object issues every step once per chunk instead, so that the dependency
+ * chains of the chunks interleave and the out-of-order core overlaps their
+ * latencies. `all_of`/`any_of` shortcuts then apply to all chunks at once.
+ */
+template <class _Tp, class _Abi>
+constexpr bool __math_per_chunk()
+{
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_storage_t<_Tp, simd_size_v<_Tp, _Abi>>::_S_tuple_size
+	   == 1;
+  else
+    return __is_abi<_Abi, simd_abi::scalar>();
+}
+
 //}}}
 // _GLIBCXX_SIMD_MATH_CALL_ {{{
 #define _GLIBCXX_SIMD_MATH_CALL_(__name)                                       \
   template <class _Tp, class _Abi, class...,                                   \
 	    class _R = std::experimental::__math_return_type_t<                \
 	      decltype(std::__name(std::declval<double>())), _Tp, _Abi>>       \
-  enable_if_t<std::is_floating_point_v<_Tp>, _R> __name(                       \
-    std::experimental::simd<_Tp, _Abi> __x)                                    \
+  _GLIBCXX_SIMD_INTRINSIC enable_if_t<std::is_floating_point_v<_Tp>, _R>       \
+    __name(const std::experimental::simd<_Tp, _Abi>& __x)                      \
   {                                                                            \
     return {std::experimental::__private_init,                                 \
 	    _Abi::_SimdImpl::__##__name(std::experimental::__data(__x))};      \
@@ -171,6 +194,66 @@ template <class _U, class _Tp, class _Abi> struct __extra_argument_type {
 				     _Simd(std::forward<_V>(__zz)));           \
   }
 
+// }}}
+// _GLIBCXX_SIMD_CVTING2 / _GLIBCXX_SIMD_CVTING3 {{{
+#define _GLIBCXX_SIMD_CVTING2(_NAME)                                           \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const simd<_Tp, _Abi>& __x, const __id<simd<_Tp, _Abi>>& __y)              \
+  {                                                                            \
+    return _NAME(__x, __y);                                                    \
+  }                                                                            \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const __id<simd<_Tp, _Abi>>& __x, const simd<_Tp, _Abi>& __y)              \
+  {                                                                            \
+    return _NAME(__x, __y);                                                    \
+  }
+
+#define _GLIBCXX_SIMD_CVTING3(_NAME)                                           \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const __id<simd<_Tp, _Abi>>& __x, const simd<_Tp, _Abi>& __y,              \
+    const simd<_Tp, _Abi>& __z)                                                \
+  {                                                                            \
+    return _NAME(__x, __y, __z);                                               \
+  }                                                                            \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const simd<_Tp, _Abi>& __x, const __id<simd<_Tp, _Abi>>& __y,              \
+    const simd<_Tp, _Abi>& __z)                                                \
+  {                                                                            \
+    return _NAME(__x, __y, __z);                                               \
+  }                                                                            \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y,                    \
+    const __id<simd<_Tp, _Abi>>& __z)                                          \
+  {                                                                            \
+    return _NAME(__x, __y, __z);                                               \
+  }                                                                            \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const simd<_Tp, _Abi>& __x, const __id<simd<_Tp, _Abi>>& __y,              \
+    const __id<simd<_Tp, _Abi>>& __z)                                          \
+  {                                                                            \
+    return _NAME(__x, __y, __z);                                               \
+  }                                                                            \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const __id<simd<_Tp, _Abi>>& __x, const simd<_Tp, _Abi>& __y,              \
+    const __id<simd<_Tp, _Abi>>& __z)                                          \
+  {                                                                            \
+    return _NAME(__x, __y, __z);                                               \
+  }                                                                            \
+  template <typename _Tp, typename _Abi>                                       \
+  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
+    const __id<simd<_Tp, _Abi>>& __x, const __id<simd<_Tp, _Abi>>& __y,        \
+    const simd<_Tp, _Abi>& __z)                                                \
+  {                                                                            \
+    return _NAME(__x, __y, __z);                                               \
+  }
+
 // }}}
 // __cosSeries {{{
 template <typename _Abi>
@@ -232,6 +315,130 @@ _GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
     return __y * (__x2 * __x) + __x;
 }
 
+// }}}
+// __tanSeries {{{
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __tanSeries(const simd<float, _Abi>& __x)
+{
+  // __x = [-pi/4, pi/4]
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = 0x1.338a76p-7f;
+  __y = __y * __x2 + 0x1.98ef38p-9f;
+  __y = __y * __x2 + 0x1.90436ap-6f;
+  __y = __y * __x2 + 0x1.b58b92p-5f;
+  __y = __y * __x2 + 0x1.112dbap-3f; // ≈ 2/15
+  __y = __y * __x2 + 0x1.5554dep-2f; // ≈ 1/3
+  return __y * (__x2 * __x) + __x;
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __tanSeries(const simd<double, _Abi>& __x)
+{
+  // __x = [-pi/4, pi/4]
+  // rational approximation: tan(x) ≈ x + x³P(x²) / Q(x²)
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __p, __q;
+  __p = -0x1.992d8d24f3f38p+13;
+  __p = __p * __x2 + 0x1.199eca5fc9dddp+20;
+  __p = __p * __x2 - 0x1.11fead3299176p+24;
+  __q = __x2 + 0x1.ab8a5eeb36572p+13;
+  __q = __q * __x2 - 0x1.427bc582abc96p+20;
+  __q = __q * __x2 + 0x1.7d98fc2ead8efp+24;
+  __q = __q * __x2 - 0x1.9afe03cbe5a31p+25;
+  return __x2 * __x * __p / __q + __x;
+}
+
+// }}}
+// __atanSeries {{{
+/**\internal
+ * Returns atan(x) - x. Adding the (small) result to x as the last step avoids
+ * an intermediate rounding of atan(x).
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __atanSeries(const simd<float, _Abi>& __x)
+{
+  // __x = [-1, 1]
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = -0x1.d62ffep-10f;
+  __y = __y * __x2 + 0x1.65a664p-7f;
+  __y = __y * __x2 - 0x1.fed168p-6f;
+  __y = __y * __x2 + 0x1.dac9e8p-5f;
+  __y = __y * __x2 - 0x1.583492p-4f;
+  __y = __y * __x2 + 0x1.c099fep-4f;
+  __y = __y * __x2 - 0x1.2421b6p-3f; // ≈ -1/7
+  __y = __y * __x2 + 0x1.9991fep-3f; // ≈  1/5
+  __y = __y * __x2 - 0x1.55553ep-2f; // ≈ -1/3
+  return __y * (__x2 * __x);
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __atanSeries(const simd<double, _Abi>& __x)
+{
+  // __x = [-0.66, 0.66]
+  // rational approximation: atan(x) - x ≈ x³P(x²) / Q(x²)
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __p, __q;
+  __p = -0x1.c007fa1f72594p-1;
+  __p = __p * __x2 - 0x1.028545b6b807ap+4;
+  __p = __p * __x2 - 0x1.2c08c36880273p+6;
+  __p = __p * __x2 - 0x1.eb8bf2d05ba25p+6;
+  __p = __p * __x2 - 0x1.03669fd28ec8ep+6;
+  __q = __x2 + 0x1.8dbc45b14603cp+4;
+  __q = __q * __x2 + 0x1.4a0dd43b8fa25p+7;
+  __q = __q * __x2 + 0x1.b0e18d2e2be3bp+8;
+  __q = __q * __x2 + 0x1.e563f13b049eap+8;
+  __q = __q * __x2 + 0x1.8519efbbd62ecp+7;
+  return __x2 * __x * __p / __q;
+}
+
+// }}}
+// __asinSeries {{{
+/**\internal
+ * Returns asin(x) - x.
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __asinSeries(const simd<float, _Abi>& __x)
+{
+  // __x = [-0.5, 0.5]
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = 0x1.5966a4p-5f;
+  __y = __y * __x2 + 0x1.8c2fc6p-6f;
+  __y = __y * __x2 + 0x1.747d8ep-5f;
+  __y = __y * __x2 + 0x1.3301ecp-4f; // ≈ 3/40
+  __y = __y * __x2 + 0x1.5555c8p-3f; // ≈ 1/6
+  return __y * (__x2 * __x);
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __asinSeries(const simd<double, _Abi>& __x)
+{
+  // __x = [-0.5, 0.5]
+  // rational approximation: asin(x) - x ≈ x³P(x²) / Q(x²)
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __p, __q;
+  __p = 0x1.16b9b0bd48ad3p-8;
+  __p = __p * __x2 - 0x1.34341333e5c16p-1;
+  __p = __p * __x2 + 0x1.5c74b178a2dd9p+2;
+  __p = __p * __x2 - 0x1.04331de27907bp+4;
+  __p = __p * __x2 + 0x1.39007da779259p+4;
+  __p = __p * __x2 - 0x1.0656c06ceafd5p+3;
+  __q = __x2 - 0x1.d7b590b5e0eabp+3;
+  __q = __q * __x2 + 0x1.19fc025fe9054p+6;
+  __q = __q * __x2 - 0x1.265bb6d3576d7p+7;
+  __q = __q * __x2 + 0x1.1705684ffbf9dp+7;
+  __q = __q * __x2 - 0x1.898220a3607acp+5;
+  return __x2 * __x * __p / __q;
+}
+
 // }}}
 // __zero_low_bits {{{
 template <int _Bits, typename _Tp, typename _Abi>
@@ -243,6 +450,34 @@ _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> __zero_low_bits(simd<_Tp, _Abi> __x)
 	  _Abi::_SimdImpl::__bit_and(__data(__x), __data(__bitmask))};
 }
 
+// }}}
+// __hi_lo {{{
+template <class _Tp, class _Abi>
+struct __hi_lo
+{
+  simd<_Tp, _Abi> _M_hi;
+  simd<_Tp, _Abi> _M_lo;
+};
+
+// }}}
+// __two_sum {{{
+/**\internal
+ * Returns `__a + __b` as `_M_hi + _M_lo` (Knuth). `_M_lo` is exact when
+ * rounding to nearest.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC __hi_lo<_Tp, _Abi>
+			__two_sum(const simd<_Tp, _Abi>& __a,
+				  const simd<_Tp, _Abi>& __b)
+{
+  using _V = simd<_Tp, _Abi>;
+  __hi_lo<_Tp, _Abi> __r;
+  __r._M_hi     = __a + __b;
+  const _V __bb = __r._M_hi - __a;
+  __r._M_lo     = (__a - (__r._M_hi - __bb)) + (__b - __bb);
+  return __r;
+}
+
 // }}}
 // __fold_input {{{
 
@@ -264,6 +499,9 @@ _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> __zero_low_bits(simd<_Tp, _Abi> __x)
  * truncation:
  * `y = round(x / ½π) * 2`.
  * If precision allows, `2/π * x` is better (faster).
+ * Since `x >= 0`, `trunc(x / ½π + ½)` rounds to nearest; in contrast to
+ * `nearbyint` it keeps the folded value in [-¼π, ¼π] independent of the
+ * current rounding mode.
  */
 template <class _Tp, class _Abi>
 struct __folded
@@ -280,6 +518,11 @@ inline constexpr float __pi_2_5bits0 =
   0x1.921fc0p0f; // π/2, 5 0-bits (least significant)
 inline constexpr float __pi_2_5bits0_rem =
   -0x1.5777a6p-21f; // π/2 - __pi_2_5bits0
+inline constexpr float __2_over_pi_hi = 0x1.45ep-1f;  // 2/π, 12 bits
+inline constexpr float __2_over_pi_lo = 0x1.306dcap-13f; // 2/π - __2_over_pi_hi
+// π/2 = Σ __pi_2_cw[i], the first four with at most 12 significant bits
+inline constexpr float __pi_2_cw[5] = {0x1.92p0f, 0x1.fb4p-12f, 0x1.444p-24f,
+				       0x1.68cp-39f, 0x1.1a6264p-54f};
 }
 namespace __math_double
 {
@@ -315,20 +558,58 @@ _GLIBCXX_SIMD_ALWAYS_INLINE __folded<float, _Abi>
     }
   else if (_GLIBCXX_SIMD_IS_LIKELY(all_of(__r._M_x < 6 * __pi_over_4)))
     {
-      const _V __y    = nearbyint(__r._M_x * __2_over_pi);
+      const _V __y    = trunc(__r._M_x * __2_over_pi + .5f);
       __r._M_quadrant = static_simd_cast<_IV>(__y) & 3; // __y mod 4
       __r._M_x -= __y * __pi_2_5bits0;
       __r._M_x -= __y * __pi_2_5bits0_rem;
     }
+  else if (_GLIBCXX_SIMD_IS_LIKELY(all_of(__r._M_x < 0x1.92p9f)))
+    {
+      // x < 804: __y <= 512 has at most 10 significant bits, thus all
+      // products with the 12-bit parts of π/2 are exact. The first two
+      // subtractions yield multiples of 2^-21 below 2 and are exact, too; the
+      // error of the third is recovered as in Fast2Sum. A quotient off by one
+      // only moves the folded value slightly beyond ¼π.
+      const _V __y    = trunc(__r._M_x * __2_over_pi + .5f);
+      __r._M_quadrant = static_simd_cast<_IV>(__y) & 3; // __y mod 4
+      constexpr float __pi_2_tail = __pi_2_cw[3] + __pi_2_cw[4];
+      _V __rx = __r._M_x;
+      __rx -= __y * __pi_2_cw[0];
+      __rx -= __y * __pi_2_cw[1];
+      const _V __p  = __y * __pi_2_cw[2];
+      const _V __hi = __rx - __p;
+      const _V __lo = (__rx - __hi) - __p;
+      __r._M_x = __hi + (__lo - __y * __pi_2_tail);
+    }
   else
     {
-      using __math_double::__2_over_pi;
-      using __math_double::__pi_2;
-      using _VD       = rebind_simd_t<double, _V>;
-      _VD __xd        = static_simd_cast<_VD>(__r._M_x);
-      _VD __y         = nearbyint(__xd * __2_over_pi);
-      __r._M_quadrant = static_simd_cast<_IV>(__y) & 3; // = __y mod 4
-      __r._M_x = static_simd_cast<_V>(__xd - __y * __pi_2);
+      // x < 2^23: multi-word Cody-Waite reduction in float.
+      // The quotient is rounded in two steps since x * 2/π itself is not
+      // exact: __t is exact and rounds exactly, the remainder is small.
+      const _V __x_hi = __zero_low_bits<12>(__r._M_x);
+      const _V __x_lo = __r._M_x - __x_hi;
+      const _V __t    = __x_hi * __2_over_pi_hi;
+      const _V __y0   = trunc(__t + .5f);
+      const _V __e    = __x_lo * __2_over_pi_hi + __r._M_x * __2_over_pi_lo;
+      const _V __y1   = floor(((__t - __y0) + __e) + .5f);
+      const _V __y    = __y0 + __y1;
+      __r._M_quadrant = static_simd_cast<_IV>(__y) & 3; // __y mod 4
+      // __y has up to 23 significant bits and π/2 is split into parts with
+      // at most 12 significant bits, thus all products are exact. The first
+      // four subtractions are exact as well, the following three keep their
+      // rounding error.
+      const _V __y_hi = __zero_low_bits<12>(__y);
+      const _V __y_lo = __y - __y_hi;
+      _V __rx = __r._M_x;
+      __rx -= __y_hi * __pi_2_cw[0];
+      __rx -= __y_lo * __pi_2_cw[0];
+      __rx -= __y_hi * __pi_2_cw[1];
+      __rx -= __y_lo * __pi_2_cw[1];
+      const auto __s0 = __two_sum(__rx, -(__y_hi * __pi_2_cw[2]));
+      const auto __s1 = __two_sum(__s0._M_hi, -(__y_lo * __pi_2_cw[2]));
+      const auto __s2 = __two_sum(__s1._M_hi, -(__y_hi * __pi_2_cw[3]));
+      __r._M_x = __s2._M_hi + (((__s0._M_lo + __s1._M_lo) + __s2._M_lo) -
+			       (__y_lo * __pi_2_cw[3] + __y * __pi_2_cw[4]));
     }
 #endif
   return __r;
@@ -348,7 +629,7 @@ _GLIBCXX_SIMD_ALWAYS_INLINE __folded<double, _Abi>
         __r._M_quadrant = 0;
         return __r;
     }
-    const _V __y = nearbyint(__r._M_x / (2 * __pi_over_4));
+    const _V __y = trunc(__r._M_x / (2 * __pi_over_4) + .5);
     __r._M_quadrant = static_simd_cast<_IV>(__y) & 3;
 
     if (_GLIBCXX_SIMD_IS_LIKELY(all_of(__r._M_x < 1025 * __pi_over_4)))
@@ -389,7 +670,8 @@ _GLIBCXX_SIMD_ALWAYS_INLINE __folded<double, _Abi>
 // }}}
 // __extract_exponent_bits {{{
 template <class _Abi>
-rebind_simd_t<int, simd<float, _Abi>> __extract_exponent_bits(const simd<float, _Abi> &__v)
+_GLIBCXX_SIMD_INTRINSIC rebind_simd_t<int, simd<float, _Abi>>
+__extract_exponent_bits(const simd<float, _Abi> &__v)
 {
     using namespace std::experimental::__proposed;
     using namespace std::experimental::__proposed::float_bitwise_operators;
@@ -399,7 +681,8 @@ rebind_simd_t<int, simd<float, _Abi>> __extract_exponent_bits(const simd<float,
 }
 
 template <class _Abi>
-rebind_simd_t<int, simd<double, _Abi>> __extract_exponent_bits(const simd<double, _Abi> &__v)
+_GLIBCXX_SIMD_INTRINSIC rebind_simd_t<int, simd<double, _Abi>>
+__extract_exponent_bits(const simd<double, _Abi> &__v)
 {
     using namespace std::experimental::__proposed;
     using namespace std::experimental::__proposed::float_bitwise_operators;
@@ -407,7 +690,17 @@ rebind_simd_t<int, simd<double, _Abi>> __extract_exponent_bits(const simd<double
         std::numeric_limits<double>::infinity();  // 0x7ff0000000000000
     constexpr auto _N = simd_size_v<double, _Abi> * 2;
     constexpr auto _Max = simd_abi::max_fixed_size<int>;
-    if constexpr (_N > _Max) {
+    if constexpr (_N > _Max && simd_size_v<double, _Abi> % (_Max / 2) == 0) {
+        // e.g. fixed_size<double, 64> (the width of AVX-512 char), which
+        // cannot be split into _Max / 2 and (_N - _Max) / 2 values
+        using _Chunk = simd<double, simd_abi::deduce_t<double, _Max / 2>>;
+        return __call_with_subscripts(
+            split<_Chunk>(__v & __exponent_mask),
+            make_index_sequence<simd_size_v<double, _Abi> / (_Max / 2)>(),
+            [](const auto&... __chunks) {
+                return concat(__extract_exponent_bits(__chunks)...);
+            });
+    } else if constexpr (_N > _Max) {
         const auto tup = split<_Max / 2, (_N - _Max) / 2>(__v & __exponent_mask);
         return concat(
             shuffle<strided<2, 1>>(
@@ -423,6 +716,42 @@ rebind_simd_t<int, simd<double, _Abi>> __extract_exponent_bits(const simd<double
     }
 }
 
+// }}}
+// __make_pow2 {{{
+/**\internal
+ * Returns 2^__n for integral \p __n in the range of normal exponents
+ * ([min_exponent - 1, max_exponent - 1]).
+ *
+ * Adding 1.5 * 2^(digits-1) moves the biased exponent into the low mantissa
+ * bits. Shifting those bits into the exponent field drops the bits of the
+ * shifter. The addition is exact, thus independent of the rounding mode.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> __make_pow2(const simd<_Tp, _Abi>& __n)
+{
+  using namespace std::experimental::__proposed;
+  using _V      = simd<_Tp, _Abi>;
+  using _IV     = rebind_simd_t<__int_for_sizeof_t<_Tp>, _V>;
+  using _Limits = std::numeric_limits<_Tp>;
+  constexpr _Tp __shifter =
+    _Tp(3ull << (_Limits::digits - 2)) + (_Limits::max_exponent - 1);
+  return simd_reinterpret_cast<_V>(simd_reinterpret_cast<_IV>(__n + __shifter)
+				   << (_Limits::digits - 1));
+}
+
+/**\internal
+ * Returns \p __x * 2^__n for integral \p __n in [2 * (min_exponent - 1),
+ * 2 * (max_exponent - 1)] via two multiplications with normal powers of two.
+ * Therefore the result is only rounded once, even if it is subnormal.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __scale_by_pow2(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __n)
+{
+  const simd<_Tp, _Abi> __n0 = trunc(__n * _Tp(.5));
+  return (__x * __make_pow2(__n0)) * __make_pow2(__n - __n0);
+}
+
 // }}}
 // __impl_or_fallback {{{
 template <class ImplFun, class FallbackFun, class... _Args>
@@ -447,10 +776,258 @@ template <class... _Args> _GLIBCXX_SIMD_INTRINSIC auto __impl_or_fallback(_Args&
 }  //}}}
 
 // trigonometric functions {{{
-_GLIBCXX_SIMD_MATH_CALL_(acos)
-_GLIBCXX_SIMD_MATH_CALL_(asin)
-_GLIBCXX_SIMD_MATH_CALL_(atan)
-_GLIBCXX_SIMD_MATH_CALL2_(atan2, _Tp)
+namespace __math_float
+{
+inline constexpr float __pi       = 0x1.921fb6p1f;    // π
+inline constexpr float __pi_lo    = -0x1.777a5cp-24f; // π - __pi
+inline constexpr float __pi_2     = 0x1.921fb6p0f;    // π/2
+inline constexpr float __pi_2_lo  = -0x1.777a5cp-25f; // π/2 - __pi_2
+// __atanSeries covers [0, 1], thus atan needs no π/4 section
+inline constexpr float __atan_mid = 1;
+inline constexpr float __atan_inv = 1;
+}
+namespace __math_double
+{
+inline constexpr double __pi       = 0x1.921fb54442d18p1;   // π
+inline constexpr double __pi_lo    = 0x1.1a62633145c07p-53; // π - __pi
+inline constexpr double __pi_2_lo  = 0x1.1a62633145c07p-54; // π/2 - __pi_2
+inline constexpr double __atan_mid = 0.66;
+inline constexpr double __atan_inv = 0x1.3504f333f9de6p1;   // tan(3π/8)
+}
+
+/*
+ * algorithm for the inverse functions:
+ *
+ * atan: Map negative __x to positive and fix the sign at the end. Reduce the
+ * argument of __atanSeries via
+ * atan(x) = π/2 + atan(-1/x)            for x > __atan_inv
+ * atan(x) = π/4 + atan((x - 1)/(x + 1)) for x > __atan_mid
+ * The two cases differ only in numerator and denominator, thus a single
+ * division suffices.
+ *
+ * asin: asin(x) = π/2 - 2 asin(√((1 - x)/2)) for x > ½. 1 - x is exact.
+ * acos: acos(x) = π/2 - asin(x) for |x| <= ½, otherwise via the same identity
+ * as asin.
+ *
+ * All of them thus compute `c + m * (t + __series(t))`, where c is a multiple
+ * of π/4 and |m * t| <= |c| unless c = 0. The series returns its result
+ * without t and c is split into two parts. __sum_hi_lo adds up the pieces
+ * with a single rounding of relevance.
+ *
+ * ±0, ±inf, and NaN need no special treatment except for atan2.
+ */
+// __sum_hi_lo {{{
+/**\internal
+ * Returns `__hi + __t + __lo` for |__hi| >= |__t| or __hi = 0 with the rounding
+ * error of `__hi + __t` compensated (Fast2Sum).
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __sum_hi_lo(const simd<_Tp, _Abi>& __hi, const simd<_Tp, _Abi>& __t,
+	      const simd<_Tp, _Abi>& __lo)
+{
+  const simd<_Tp, _Abi> __s = __hi + __t;
+  return __s + (__lo + ((__hi - __s) + __t));
+}
+
+// }}}
+//atan{{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  atan(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__atan(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      constexpr bool __f32 = is_same_v<_Tp, float>;
+      constexpr _Tp  __mid =
+	__f32 ? __math_float::__atan_mid : __math_double::__atan_mid;
+      constexpr _Tp __inv =
+	__f32 ? __math_float::__atan_inv : __math_double::__atan_inv;
+      constexpr _Tp __pi_2 = __f32 ? __math_float::__pi_2 : __math_double::__pi_2;
+      constexpr _Tp __pi_2_lo =
+	__f32 ? __math_float::__pi_2_lo : __math_double::__pi_2_lo;
+
+      const _V __a = abs(__x);
+      if (_GLIBCXX_SIMD_IS_LIKELY(all_of(__a <= __mid)))
+	return __x + __atanSeries(__x);
+
+      _V __num = __a;
+      _V __den = 1;
+      _V __hi  = 0;
+      _V __lo  = 0;
+      if constexpr (__mid < __inv)
+	{
+	  const auto __in_mid = __a > __mid && __a <= __inv;
+	  where(__in_mid, __num) = __a - 1;
+	  where(__in_mid, __den) = __a + 1;
+	  where(__in_mid, __hi)  = _Tp(.5) * __pi_2;
+	  where(__in_mid, __lo)  = _Tp(.5) * __pi_2_lo;
+	}
+      const auto __large   = __a > __inv;
+      where(__large, __num) = -1;
+      where(__large, __den) = __a;
+      where(__large, __hi)  = __pi_2;
+      where(__large, __lo)  = __pi_2_lo;
+      const _V __t = __num / __den;
+      const _V __r = __sum_hi_lo(__hi, __t, __lo + __atanSeries(__t));
+      return __r ^ (__x & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    atan(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::atan(__data(__x));
+}
+//}}}
+//atan2{{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  atan2(const simd<_Tp, _Abi>& __y, const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__atan2(__data(__y), __data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      using _Limits        = std::numeric_limits<_Tp>;
+      constexpr bool __f32 = is_same_v<_Tp, float>;
+      constexpr _Tp  __pi  = __f32 ? __math_float::__pi : __math_double::__pi;
+      constexpr _Tp  __pi_lo =
+	__f32 ? __math_float::__pi_lo : __math_double::__pi_lo;
+
+      // atan2(y, x) = ±atan(|y|/|x|)       for x >= +0
+      // atan2(y, x) = ±(π - atan(|y|/|x|)) for x <= -0
+      const _V __ay = abs(__y);
+      const _V __ax = abs(__x);
+      const _V __q  = __ay / __ax;
+      _V       __r  = atan(__q);
+      // |y|/|x| is NaN for 0/0 and inf/inf, which must yield 0 and π/4
+      const auto __zeros = __ay == 0 && __ax == 0;
+      const auto __infs  = __ay == _Limits::infinity() && __ax == __ay;
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(__zeros || __infs)))
+	{
+	  where(__zeros, __r) = 0;
+	  where(__infs, __r)  = _Tp(.25) * __pi;
+	}
+      // π - atan(∞) would round twice; the result is ±π/2 for either sign of x
+      const auto __neg  = signbit(__x) && __q != _Limits::infinity();
+      where(__neg, __r) = (__pi_lo - __r) + __pi;
+      // 3π/4 = π - π/4 would round twice
+      where(__infs && __neg, __r) = _Tp(.75) * __pi;
+      return __r ^ (__y & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    atan2(simd<_Tp, simd_abi::scalar> __y, simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::atan2(__data(__y), __data(__x));
+}
+_GLIBCXX_SIMD_CVTING2(atan2)
+//}}}
+//asin{{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  asin(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__asin(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      constexpr bool __f32 = is_same_v<_Tp, float>;
+      constexpr _Tp __pi_2 = __f32 ? __math_float::__pi_2 : __math_double::__pi_2;
+      constexpr _Tp __pi_2_lo =
+	__f32 ? __math_float::__pi_2_lo : __math_double::__pi_2_lo;
+
+      const _V   __a     = abs(__x);
+      const auto __large = __a > _Tp(.5);
+      if (_GLIBCXX_SIMD_IS_LIKELY(none_of(__large)))
+	return __x + __asinSeries(__x);
+
+      _V __t = __a;
+      // NaN for |x| > 1
+      where(__large, __t) = sqrt((1 - __a) * _Tp(.5));
+      const _V __s        = __asinSeries(__t);
+      _V       __r        = __t + __s;
+      where(__large, __r) =
+	__sum_hi_lo(_V(__pi_2), -2 * __t, __pi_2_lo - 2 * __s);
+      return __r ^ (__x & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    asin(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::asin(__data(__x));
+}
+//}}}
+//acos{{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  acos(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__acos(__data(__x))};
+    }
+  else
+    {
+      constexpr bool __f32 = is_same_v<_Tp, float>;
+      constexpr _Tp  __pi  = __f32 ? __math_float::__pi : __math_double::__pi;
+      constexpr _Tp  __pi_lo =
+	__f32 ? __math_float::__pi_lo : __math_double::__pi_lo;
+      constexpr _Tp __pi_2 = __f32 ? __math_float::__pi_2 : __math_double::__pi_2;
+      constexpr _Tp __pi_2_lo =
+	__f32 ? __math_float::__pi_2_lo : __math_double::__pi_2_lo;
+
+      const auto __large = abs(__x) > _Tp(.5);
+      if (_GLIBCXX_SIMD_IS_LIKELY(none_of(__large)))
+	return __sum_hi_lo(_V(__pi_2), -__x, __pi_2_lo - __asinSeries(__x));
+
+      // acos(x) = 2 asin(√((1 - x)/2))     for x > ½
+      // acos(x) = π - 2 asin(√((1 + x)/2)) for x < -½
+      _V __t = __x;
+      // NaN for |x| > 1
+      where(__large, __t) = sqrt((1 - abs(__x)) * _Tp(.5));
+      const _V __s        = __asinSeries(__t);
+      _V       __r = __sum_hi_lo(_V(__pi_2), -__t, __pi_2_lo - __s);
+      where(__large, __r) = 2 * (__t + __s);
+      where(__large && __x < 0, __r) =
+	__sum_hi_lo(_V(__pi), -2 * __t, __pi_lo - 2 * __s);
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    acos(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::acos(__data(__x));
+}
+//}}}
 
 /*
  * algorithm for sine and cosine:
@@ -474,15 +1051,14 @@ enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
   cos(const simd<_Tp, _Abi>& __x)
 {
   using _V = simd<_Tp, _Abi>;
-  if constexpr (__is_abi<_Abi, simd_abi::scalar>() ||
-		__is_fixed_size_abi_v<_Abi>)
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
     {
       return {__private_init, _Abi::_SimdImpl::__cos(__data(__x))};
     }
   else
     {
       if constexpr (is_same_v<_Tp, float>)
-	if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__x) >= 393382)))
+	if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__x) >= 0x1p23f)))
 	  return static_simd_cast<_V>(
 	    cos(static_simd_cast<rebind_simd_t<double, _V>>(__x)));
 
@@ -528,15 +1104,14 @@ enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
   sin(const simd<_Tp, _Abi>& __x)
 {
   using _V = simd<_Tp, _Abi>;
-  if constexpr (__is_abi<_Abi, simd_abi::scalar>() ||
-		__is_fixed_size_abi_v<_Abi>)
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
     {
       return {__private_init, _Abi::_SimdImpl::__sin(__data(__x))};
     }
   else
     {
       if constexpr (is_same_v<_Tp, float>)
-	if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__x) >= 527449)))
+	if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__x) >= 0x1p23f)))
 	  return static_simd_cast<_V>(
 	    sin(static_simd_cast<rebind_simd_t<double, _V>>(__x)));
 
@@ -576,187 +1151,1263 @@ _GLIBCXX_SIMD_ALWAYS_INLINE
     return std::sin(__data(__x));
 }
 //}}}
+//sincos{{{
+namespace __proposed
+{
+/**
+ * Returns `{sin(x), cos(x)}`. Both results share one range reduction and one
+ * evaluation of each series; only the quadrant decides which series is sine
+ * and which is cosine.
+ */
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>,
+	    std::pair<simd<_Tp, _Abi>, simd<_Tp, _Abi>>>
+  sincos(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_abi<_Abi, simd_abi::scalar>())
+    {
+      return {std::sin(__data(__x)), std::cos(__data(__x))};
+    }
+  else if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      _V __cos;
+      const _V __sin = {
+	__private_init,
+	__data(__x).__apply_per_chunk(
+	  [](auto __impl, auto __xx, auto& __cc) {
+	    using _V2 = typename decltype(__impl)::simd_type;
+	    const auto __r = sincos(_V2(__private_init, __xx));
+	    __cc           = __data(__r.second);
+	    return __data(__r.first);
+	  },
+	  __data(__cos))};
+      return {__sin, __cos};
+    }
+  else
+    {
+      if constexpr (is_same_v<_Tp, float>)
+	if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__x) >= 0x1p23f)))
+	  {
+	    const auto __r =
+	      sincos(static_simd_cast<rebind_simd_t<double, _V>>(__x));
+	    return {static_simd_cast<_V>(__r.first),
+		    static_simd_cast<_V>(__r.second)};
+	  }
+
+      const auto __f = __fold_input(__x);
+      // quadrant | sin            | cos
+      //        0 | sinSeries      | cosSeries
+      //        1 | cosSeries      | sinSeries, -
+      //        2 | sinSeries, -   | cosSeries, -
+      //        3 | cosSeries, -   | sinSeries
+      // sin is odd, the sign of __x is applied on top
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      const _V __sin_flip =
+	(__x ^ static_simd_cast<_V>(1 - __f._M_quadrant)) & _V(_Tp(-0.));
+      const _V __cos_flip =
+	_V(_Tp(-0.)) & static_simd_cast<_V>((1 + __f._M_quadrant) << 30);
+
+      const _V __s   = __sinSeries(__f._M_x);
+      const _V __c   = __cosSeries(__f._M_x);
+      _V       __sin = __s;
+      _V       __cos = __c;
+      const auto __swap = (__f._M_quadrant & 1) != 0;
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__swap)))
+	{
+	  const typename _V::mask_type __k = __swap.__cvt();
+	  where(__k, __sin)                = __c;
+	  where(__k, __cos)                = __s;
+	}
+      return {__sin ^ __sin_flip, __cos ^ __cos_flip};
+    }
+}
+} // namespace __proposed
+//}}}
+
+//tan{{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  tan(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__tan(__data(__x))};
+    }
+  else
+    {
+      // __fold_input loses precision for quotients beyond 2^30
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__x) >= _Tp(0x1p30))))
+	return {__private_init, _Abi::_SimdImpl::__tan(__data(__x))};
+      if constexpr (is_same_v<_Tp, float>)
+	if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__x) >= 0x1p23f)))
+	  return static_simd_cast<_V>(
+	    tan(static_simd_cast<rebind_simd_t<double, _V>>(__x)));
+
+      const auto __f = __fold_input(__x);
+      // quadrant | effect
+      //        0 | tanSeries
+      //        1 | -1/tanSeries
+      //        2 | tanSeries
+      //        3 | -1/tanSeries
+      // tan is odd, the sign of __x is applied at the end
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      _V __r = __tanSeries(__f._M_x);
+      const auto __need_cot = (__f._M_quadrant & 1) != 0;
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(__need_cot)))
+	where(__need_cot.__cvt(), __r) = _Tp(-1) / __r;
+      return __r ^ (__x & _V(_Tp(-0.)));
+    }
+}
 
-_GLIBCXX_SIMD_MATH_CALL_(tan)
-_GLIBCXX_SIMD_MATH_CALL_(acosh)
-_GLIBCXX_SIMD_MATH_CALL_(asinh)
-_GLIBCXX_SIMD_MATH_CALL_(atanh)
-_GLIBCXX_SIMD_MATH_CALL_(cosh)
-_GLIBCXX_SIMD_MATH_CALL_(sinh)
-_GLIBCXX_SIMD_MATH_CALL_(tanh)
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    tan(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::tan(__data(__x));
+}
+//}}}
 // }}}
 // exponential functions {{{
-_GLIBCXX_SIMD_MATH_CALL_(exp)
-_GLIBCXX_SIMD_MATH_CALL_(exp2)
-_GLIBCXX_SIMD_MATH_CALL_(expm1)
-// }}}
-// frexp {{{
-template <class _Tp, size_t _N> _SimdWrapper<_Tp, _N> __getexp(_SimdWrapper<_Tp, _N> __x)
+namespace __math_float
 {
-    if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>()) {
-        return _mm_getexp_ps(__x);
-    } else if constexpr (__have_avx512f && __is_sse_ps<_Tp, _N>()) {
-        return __lo128(_mm512_getexp_ps(__auto_bitcast(__x)));
-    } else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>()) {
-        return _mm_getexp_pd(__x);
-    } else if constexpr (__have_avx512f && __is_sse_pd<_Tp, _N>()) {
-        return __lo128(_mm512_getexp_pd(__auto_bitcast(__x)));
-    } else if constexpr (__have_avx512vl && __is_avx_ps<_Tp, _N>()) {
-        return _mm256_getexp_ps(__x);
-    } else if constexpr (__have_avx512f && __is_avx_ps<_Tp, _N>()) {
-        return __lo256(_mm512_getexp_ps(__auto_bitcast(__x)));
-    } else if constexpr (__have_avx512vl && __is_avx_pd<_Tp, _N>()) {
-        return _mm256_getexp_pd(__x);
-    } else if constexpr (__have_avx512f && __is_avx_pd<_Tp, _N>()) {
-        return __lo256(_mm512_getexp_pd(__auto_bitcast(__x)));
-    } else if constexpr (__is_avx512_ps<_Tp, _N>()) {
-        return _mm512_getexp_ps(__x);
-    } else if constexpr (__is_avx512_pd<_Tp, _N>()) {
-        return _mm512_getexp_pd(__x);
-    } else {
-        __assert_unreachable<_Tp>();
-    }
+inline constexpr float __log2e  = 0x1.715476p0f;    // 1/ln(2)
+inline constexpr float __ln2_hi = 0x1.630000p-1f;   // ln(2), 9 significant bits
+inline constexpr float __ln2_lo = -0x1.bd0106p-13f; // ln(2) - __ln2_hi
+}
+namespace __math_double
+{
+inline constexpr double __log2e  = 0x1.71547652b82fep0;  // 1/ln(2)
+inline constexpr double __ln2    = 0x1.62e42fefa39efp-1; // ln(2)
+inline constexpr double __ln2_hi = 0x1.62e4000000000p-1; // ln(2), 15 significant bits
+inline constexpr double __ln2_lo = 0x1.7f7d1cf79abcap-20; // ln(2) - __ln2_hi
 }
 
-#if _GLIBCXX_SIMD_X86INTRIN
-template <class _Tp, size_t _N> _SimdWrapper<_Tp, _N> __getmant_avx512(_SimdWrapper<_Tp, _N> __x)
+// __expm1Series {{{
+/**\internal
+ * Approximates e^x - 1 for x in [-½ln2, ½ln2].
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __expm1Series(const simd<float, _Abi>& __x)
 {
-    if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>()) {
-        return _mm_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
-    } else if constexpr (__have_avx512f && __is_sse_ps<_Tp, _N>()) {
-        return __lo128(
-            _mm512_getmant_ps(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
-    } else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>()) {
-        return _mm_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
-    } else if constexpr (__have_avx512f && __is_sse_pd<_Tp, _N>()) {
-        return __lo128(
-            _mm512_getmant_pd(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
-    } else if constexpr (__have_avx512vl && __is_avx_ps<_Tp, _N>()) {
-        return _mm256_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
-    } else if constexpr (__have_avx512f && __is_avx_ps<_Tp, _N>()) {
-        return __lo256(
-            _mm512_getmant_ps(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
-    } else if constexpr (__have_avx512vl && __is_avx_pd<_Tp, _N>()) {
-        return _mm256_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
-    } else if constexpr (__have_avx512f && __is_avx_pd<_Tp, _N>()) {
-        return __lo256(
-            _mm512_getmant_pd(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
-    } else if constexpr (__is_avx512_ps<_Tp, _N>()) {
-        return _mm512_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
-    } else if constexpr (__is_avx512_pd<_Tp, _N>()) {
-        return _mm512_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
-    } else {
-        __assert_unreachable<_Tp>();
-    }
+  simd<float, _Abi> __y;
+  __y = 0x1.a0d2cep-13f;              // ≈ 1/7!
+  __y = __y * __x + 0x1.6e879cp-10f;  // ≈ 1/6!
+  __y = __y * __x + 0x1.111210p-7f;   // ≈ 1/5!
+  __y = __y * __x + 0x1.555382p-5f;   // ≈ 1/4!
+  __y = __y * __x + 0x1.555554p-3f;   // ≈ 1/3!
+  __y = __y * __x + 0x1.000000p-1f;   // ≈ 1/2!
+  return __y * (__x * __x) + __x;
 }
-#endif // _GLIBCXX_SIMD_X86INTRIN
 
-/**
- * splits \p __v into exponent and mantissa, the sign is kept with the mantissa
- *
- * The return value will be in the range [0.5, 1.0[
- * The \p __e value will be an integer defining the power-of-two exponent
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __expm1Series(const simd<double, _Abi>& __x)
+{
+  // Taylor series up to x^13; the truncation error is below 0.1 ulp
+  simd<double, _Abi> __y;
+  __y = 0x1.6124613a86d09p-33;              // 1/13!
+  __y = __y * __x + 0x1.1eed8eff8d898p-29;  // 1/12!
+  __y = __y * __x + 0x1.ae64567f544e4p-26;  // 1/11!
+  __y = __y * __x + 0x1.27e4fb7789f5cp-22;  // 1/10!
+  __y = __y * __x + 0x1.71de3a556c734p-19;  // 1/9!
+  __y = __y * __x + 0x1.a01a01a01a01ap-16;  // 1/8!
+  __y = __y * __x + 0x1.a01a01a01a01ap-13;  // 1/7!
+  __y = __y * __x + 0x1.6c16c16c16c17p-10;  // 1/6!
+  __y = __y * __x + 0x1.1111111111111p-7;   // 1/5!
+  __y = __y * __x + 0x1.5555555555555p-5;   // 1/4!
+  __y = __y * __x + 0x1.5555555555555p-3;   // 1/3!
+  __y = __y * __x + 0x1.0000000000000p-1;   // 1/2!
+  return __y * (__x * __x) + __x;
+}
+
+// }}}
+// __fold_ln2 {{{
+/**\internal
+ * Splits \p __x into `__n * ln2 + __r` with integral `__n` and
+ * `__r` in [-½ln2, ½ln2]. Then e^x = 2^n * e^r.
+ * `round` (instead of `nearbyint`) keeps `__r` in range independent of the
+ * current rounding mode.
  */
 template <class _Tp, class _Abi>
-enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>> frexp(
-    const simd<_Tp, _Abi> &__x, __samesize<int, simd<_Tp, _Abi>> *__exp)
+struct __ln2_folded
 {
-    if constexpr (simd_size_v<_Tp, _Abi> == 1) {
-        int __tmp;
-        const auto __r = std::frexp(__x[0], &__tmp);
-        (*__exp)[0] = __tmp;
-        return __r;
-    } else if constexpr (__is_fixed_size_abi_v<_Abi>) {
-        return {__private_init, _Abi::_SimdImpl::__frexp(__data(__x), __data(*__exp))};
-#if _GLIBCXX_SIMD_X86INTRIN
-    } else if constexpr (__have_avx512f) {
-        using _IV = __samesize<int, simd<_Tp, _Abi>>;
-        constexpr size_t _N = simd_size_v<_Tp, _Abi>;
-        constexpr size_t NI = _N < 4 ? 4 : _N;
-        const auto __v = __data(__x);
-        const auto __isnonzero = _Abi::_SimdImpl::__isnonzerovalue_mask(__v._M_data);
-        const auto __e =
-            __to_intrin(__blend(__isnonzero, __vector_type_t<int, NI>(),
-                                1 + __convert<_SimdWrapper<int, NI>>(__getexp(__v))._M_data));
-        __vector_store<_N * sizeof(int)>(__e, __exp, overaligned<alignof(_IV)>);
-        return {__private_init, __blend(__isnonzero, __v, __getmant_avx512(__v))};
-#endif // _GLIBCXX_SIMD_X86INTRIN
-    } else {
-        // fallback implementation
-        static_assert(sizeof(_Tp) == 4 || sizeof(_Tp) == 8);
-        using _V = simd<_Tp, _Abi>;
-        using _IV = rebind_simd_t<int, _V>;
-        using _IM = typename _IV::mask_type;
-        using _Limits = std::numeric_limits<_Tp>;
-        using namespace std::experimental::__proposed;
-        using namespace std::experimental::__proposed::float_bitwise_operators;
+  simd<_Tp, _Abi> _M_r;
+  simd<_Tp, _Abi> _M_n;
+};
 
-	constexpr int __exp_shift     = sizeof(_Tp) == 4 ? 23 : 20;
-	constexpr int __exp_adjust    = sizeof(_Tp) == 4 ? 0x7e : 0x3fe;
-	constexpr int __exp_offset    = sizeof(_Tp) == 4 ? 0x70 : 0x200;
-	constexpr _Tp __subnorm_scale = sizeof(_Tp) == 4 ? 0x1p112 : 0x1p512;
-	constexpr _V  __exponent_mask =
-	  _Limits::infinity(); // 0x7f800000 or 0x7ff0000000000000
-	constexpr _V __p5_1_exponent =
-	  _Tp(sizeof(_Tp) == 4 ? -0x1.fffffep-1 : -0x1.fffffffffffffp-1);
+template <class _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE __ln2_folded<float, _Abi>
+			    __fold_ln2(const simd<float, _Abi>& __x)
+{
+  using namespace __math_float;
+  __ln2_folded<float, _Abi> __r;
+  __r._M_n = round(__x * __log2e);
+  // __n * __ln2_hi is exact since |__n| < 2^8 and __ln2_hi has 9 significant bits
+  __r._M_r = (__x - __r._M_n * __ln2_hi) - __r._M_n * __ln2_lo;
+  return __r;
+}
 
-	_V __mant = __p5_1_exponent & (__exponent_mask | __x);
-        const _IV __exponent_bits = __extract_exponent_bits(__x);
-        if (_GLIBCXX_SIMD_IS_LIKELY(all_of(isnormal(__x)))) {
-            *__exp = simd_cast<__samesize<int, _V>>((__exponent_bits >> __exp_shift) -
-                                                       __exp_adjust);
-            return __mant;
-        }
-        const auto __iszero_inf_nan = isunordered(__x * _Limits::infinity(), __x * _V());
-        const _V __scaled_subnormal = __x * __subnorm_scale;
-        const _V __mant_subnormal = __p5_1_exponent & (__exponent_mask | __scaled_subnormal);
-        where(!isnormal(__x), __mant) = __mant_subnormal;
-        where(__iszero_inf_nan, __mant) = __x;
-        _IV __e = __extract_exponent_bits(__scaled_subnormal);
-        const _IM __value_isnormal = static_simd_cast<_IM>(isnormal(__x));
-        where(__value_isnormal, __e) = __exponent_bits;
-        const _IV __offset = (simd_reinterpret_cast<_IV>(__value_isnormal) & _IV(__exp_adjust)) |
-                          (simd_reinterpret_cast<_IV>((__exponent_bits == 0) &
-                                                     (static_simd_cast<_IM>(__x != 0))) &
-                           _IV(__exp_adjust + __exp_offset));
-        *__exp = simd_cast<__samesize<int, _V>>((__e >> __exp_shift) - __offset);
-        return __mant;
+template <class _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE __ln2_folded<double, _Abi>
+			    __fold_ln2(const simd<double, _Abi>& __x)
+{
+  using namespace __math_double;
+  __ln2_folded<double, _Abi> __r;
+  __r._M_n = round(__x * __log2e);
+  // __n * __ln2_hi is exact since |__n| < 2^11 and __ln2_hi has 15 significant bits
+  __r._M_r = (__x - __r._M_n * __ln2_hi) - __r._M_n * __ln2_lo;
+  return __r;
+}
+
+// }}}
+// exp {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  exp(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__exp(__data(__x))};
+    }
+  else
+    {
+      using _Limits = std::numeric_limits<_Tp>;
+      // 2^n stays normal for |n| <= max_exponent - 2
+      constexpr _Tp __fast_limit =
+	(_Limits::max_exponent - 2) * __math_double::__ln2;
+      // one beyond the over- and underflow thresholds, thus the final scaling
+      // over-/underflows according to the current rounding mode
+      constexpr _Tp __max_arg =
+	(_Limits::max_exponent + 1) * __math_double::__ln2;
+      constexpr _Tp __min_arg =
+	(_Limits::min_exponent - _Limits::digits - 2) * __math_double::__ln2;
+      if (_GLIBCXX_SIMD_IS_LIKELY(all_of(abs(__x) < __fast_limit)))
+	{
+	  const auto __f = __fold_ln2(__x);
+	  return (1 + __expm1Series(__f._M_r)) * __make_pow2(__f._M_n);
+	}
+      else
+	{
+	  const auto __f = __fold_ln2(clamp(__x, _V(__min_arg), _V(__max_arg)));
+	  _V __r = __scale_by_pow2(1 + __expm1Series(__f._M_r), __f._M_n);
+	  where(isnan(__x) || __x == _Limits::infinity(), __r) = __x;
+	  where(__x == -_Limits::infinity(), __r)            = 0;
+	  return __r;
+	}
     }
 }
+
 // }}}
-_GLIBCXX_SIMD_MATH_CALL2_(ldexp, int)
-_GLIBCXX_SIMD_MATH_CALL_(ilogb)
+// exp2 {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  exp2(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__exp2(__data(__x))};
+    }
+  else
+    {
+      using _Limits = std::numeric_limits<_Tp>;
+      // 2^x = 2^n * e^((x - n) * ln2), x - n is exact
+      constexpr _Tp __ln2          = __math_double::__ln2;
+      constexpr _Tp __fast_limit = _Limits::max_exponent - 2;
+      if (_GLIBCXX_SIMD_IS_LIKELY(all_of(abs(__x) < __fast_limit)))
+	{
+	  const _V __n = round(__x);
+	  return (1 + __expm1Series((__x - __n) * __ln2)) * __make_pow2(__n);
+	}
+      else
+	{
+	  // see exp for the choice of the clamping range
+	  constexpr _Tp __max_arg = _Limits::max_exponent + 1;
+	  constexpr _Tp __min_arg = _Limits::min_exponent - _Limits::digits - 2;
+	  const _V      __xc = clamp(__x, _V(__min_arg), _V(__max_arg));
+	  const _V      __n  = round(__xc);
+	  _V            __r  = __scale_by_pow2(
+	    1 + __expm1Series((__xc - __n) * __ln2), __n);
+	  where(isnan(__x) || __x == _Limits::infinity(), __r) = __x;
+	  where(__x == -_Limits::infinity(), __r)            = 0;
+	  return __r;
+	}
+    }
+}
 
-// logarithms {{{
-_GLIBCXX_SIMD_MATH_CALL_(log)
-_GLIBCXX_SIMD_MATH_CALL_(log10)
-_GLIBCXX_SIMD_MATH_CALL_(log1p)
-_GLIBCXX_SIMD_MATH_CALL_(log2)
-//}}}
-//logb{{{
+// }}}
+// expm1 {{{
 template <class _Tp, class _Abi>
-enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, _Abi>> logb(
-    const simd<_Tp, _Abi> &__x)
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  expm1(const simd<_Tp, _Abi>& __x)
 {
-    constexpr size_t _N = simd_size_v<_Tp, _Abi>;
-    if constexpr (_N == 1) {
-        return std::logb(__x[0]);
-    } else if constexpr (__is_fixed_size_abi_v<_Abi>) {
-	return {__private_init,
-		__data(__x).__apply_per_chunk([](auto __impl, auto __xx) {
-		  using _V = typename decltype(__impl)::simd_type;
-		  return __data(
-		    std::experimental::logb(_V(__private_init, __xx)));
-		})};
-      }
-    else if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>())
-      {
-	return {__private_init, _mm_getexp_ps(__data(__x))};
-      }
-    else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>())
-      {
-	return {__private_init, _mm_getexp_pd(__data(__x))};
-      }
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__expm1(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      using _Limits = std::numeric_limits<_Tp>;
+      // e^x - 1 = 2^n * (e^r - 1) + (2^n - 1)
+      // 2^n - 1 is exact as long as 2^n is not too large. For larger n the -1
+      // is irrelevant and __x beyond __fast_limit can use exp instead.
+      constexpr _Tp __fast_limit =
+	(_Limits::max_exponent - 2) * __math_double::__ln2;
+      const auto __f = __fold_ln2(clamp(__x, _V(-__fast_limit), _V(__fast_limit)));
+      const _V   __p = __make_pow2(__f._M_n);
+      // e^x - 1 has the sign of x, which is relevant for -0
+      _V __r = (__p * __expm1Series(__f._M_r) + (__p - 1)) | (__x & _V(_Tp(-0.)));
+      // For __x <= -__fast_limit `__p - 1` rounds to -1 (or its successor,
+      // depending on the rounding mode), which is the correct result.
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(!all_of(abs(__x) < __fast_limit)))
+	{
+	  where(__x >= __fast_limit, __r)          = exp(__x);
+	  where(__x == -_Limits::infinity(), __r) = -1;
+	  where(isnan(__x), __r)                  = __x;
+	}
+      return __r;
+    }
+}
+
+// }}}
+// }}}
+// hyperbolic functions {{{
+/*
+ * algorithm for sinh, cosh, and tanh:
+ *
+ * For |x| < 1 (tanh: |x| < 0.625) a polynomial approximates the function.
+ * Otherwise, with a = |x|:
+ * sinh(a) = (e^a - e^-a) / 2   (e^-a <= e^-2 e^a, thus no cancellation)
+ * cosh(a) = (e^a + e^-a) / 2
+ * tanh(a) = (e^2a - 1) / (e^2a + 1) = expm1(2a) / (expm1(2a) + 2)
+ * The result is selected per element via where; each branch is only
+ * evaluated if any element needs it.
+ *
+ * e^a overflows before sinh(a) and cosh(a) do. Therefore large a calculate
+ * e^a / 2 directly, i.e. exp with the final scaling reduced by 1.
+ */
+// __sinhSeries {{{
+/**\internal
+ * Approximates sinh(x) - x for |x| < 1 (Taylor series).
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __sinhSeries(const simd<float, _Abi>& __x)
+{
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = 0x1.ae6456p-26f;              // 1/11!
+  __y = __y * __x2 + 0x1.71de3ap-19f; // 1/9!
+  __y = __y * __x2 + 0x1.a01a02p-13f; // 1/7!
+  __y = __y * __x2 + 0x1.111112p-7f;  // 1/5!
+  __y = __y * __x2 + 0x1.555556p-3f;  // 1/3!
+  return __y * (__x2 * __x);
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __sinhSeries(const simd<double, _Abi>& __x)
+{
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __y;
+  __y = 0x1.2f49b46814157p-57;              // 1/19!
+  __y = __y * __x2 + 0x1.952c77030ad4ap-49; // 1/17!
+  __y = __y * __x2 + 0x1.ae7f3e733b81fp-41; // 1/15!
+  __y = __y * __x2 + 0x1.6124613a86d09p-33; // 1/13!
+  __y = __y * __x2 + 0x1.ae64567f544e4p-26; // 1/11!
+  __y = __y * __x2 + 0x1.71de3a556c734p-19; // 1/9!
+  __y = __y * __x2 + 0x1.a01a01a01a01ap-13; // 1/7!
+  __y = __y * __x2 + 0x1.1111111111111p-7;  // 1/5!
+  __y = __y * __x2 + 0x1.5555555555555p-3;  // 1/3!
+  return __y * (__x2 * __x);
+}
+
+// }}}
+// __coshSeries {{{
+/**\internal
+ * Approximates cosh(x) - 1 for |x| < 1 (Taylor series).
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __coshSeries(const simd<float, _Abi>& __x)
+{
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = 0x1.27e4fcp-22f;              // 1/10!
+  __y = __y * __x2 + 0x1.a01a02p-16f; // 1/8!
+  __y = __y * __x2 + 0x1.6c16c2p-10f; // 1/6!
+  __y = __y * __x2 + 0x1.555556p-5f;  // 1/4!
+  __y = __y * __x2 + 0x1.000000p-1f;  // 1/2!
+  return __y * __x2;
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __coshSeries(const simd<double, _Abi>& __x)
+{
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __y;
+  __y = 0x1.6827863b97d97p-53;              // 1/18!
+  __y = __y * __x2 + 0x1.ae7f3e733b81fp-45; // 1/16!
+  __y = __y * __x2 + 0x1.93974a8c07c9dp-37; // 1/14!
+  __y = __y * __x2 + 0x1.1eed8eff8d898p-29; // 1/12!
+  __y = __y * __x2 + 0x1.27e4fb7789f5cp-22; // 1/10!
+  __y = __y * __x2 + 0x1.a01a01a01a01ap-16; // 1/8!
+  __y = __y * __x2 + 0x1.6c16c16c16c17p-10; // 1/6!
+  __y = __y * __x2 + 0x1.5555555555555p-5;  // 1/4!
+  __y = __y * __x2 + 0x1.0000000000000p-1;  // 1/2!
+  return __y * __x2;
+}
+
+// }}}
+// __tanhSeries {{{
+/**\internal
+ * Approximates tanh(x) - x for |x| < 0.625 (Cephes).
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __tanhSeries(const simd<float, _Abi>& __x)
+{
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = -5.70498872745e-3f;
+  __y = __y * __x2 + 2.06390887954e-2f;
+  __y = __y * __x2 - 5.37397155531e-2f;
+  __y = __y * __x2 + 1.33314422036e-1f;
+  __y = __y * __x2 - 3.33332819422e-1f;
+  return __y * (__x2 * __x);
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __tanhSeries(const simd<double, _Abi>& __x)
+{
+  // x³P(x²)/Q(x²)
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __p, __q;
+  __p = -9.64399179425052238628e-1;
+  __p = __p * __x2 - 9.92877231001918586564e1;
+  __p = __p * __x2 - 1.61468768441708447952e3;
+  __q = __x2 + 1.12811678491632931402e2;
+  __q = __q * __x2 + 2.23548839060100448583e3;
+  __q = __q * __x2 + 4.84406305325125486048e3;
+  return __x2 * __x * __p / __q;
+}
+
+// }}}
+// __exp_half {{{
+/**\internal
+ * Returns e^x / 2 for x >= 0 (NaN excluded) without overflow in an
+ * intermediate e^x.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> __exp_half(const simd<_Tp, _Abi>& __x)
+{
+  using _Limits = std::numeric_limits<_Tp>;
+  // one beyond the overflow threshold, see exp
+  constexpr _Tp __max_arg = (_Limits::max_exponent + 2) * __math_double::__ln2;
+  const auto __f = __fold_ln2(min(__x, simd<_Tp, _Abi>(__max_arg)));
+  return __scale_by_pow2(1 + __expm1Series(__f._M_r), __f._M_n - 1);
+}
+
+// }}}
+// sinh {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  sinh(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__sinh(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      using _Limits = std::numeric_limits<_Tp>;
+      // e^a is finite and normal
+      constexpr _Tp __exp_limit =
+	(_Limits::max_exponent - 1) * __math_double::__ln2;
+      const _V   __a     = abs(__x);
+      const auto __small = __a < 1;
+      _V         __r;
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+	__r = __a + __sinhSeries(__a);
+      if (!all_of(__small))
+	{
+	  const _V __e = exp(min(__a, _V(__exp_limit)));
+	  where(!__small, __r) = __e * _Tp(.5) - _Tp(.5) / __e;
+	  if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(__a > __exp_limit)))
+	    where(__a > __exp_limit, __r) = __exp_half(__a);
+	  where(isnan(__x), __r) = __a;
+	}
+      return __r | (__x & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    sinh(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::sinh(__data(__x));
+}
+
+// }}}
+// cosh {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  cosh(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__cosh(__data(__x))};
+    }
+  else
+    {
+      using _Limits = std::numeric_limits<_Tp>;
+      // e^a is finite and normal
+      constexpr _Tp __exp_limit =
+	(_Limits::max_exponent - 1) * __math_double::__ln2;
+      const _V   __a     = abs(__x);
+      const auto __small = __a < 1;
+      _V         __r;
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+	__r = 1 + __coshSeries(__a);
+      if (!all_of(__small))
+	{
+	  const _V __e = exp(min(__a, _V(__exp_limit)));
+	  where(!__small, __r) = __e * _Tp(.5) + _Tp(.5) / __e;
+	  if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(__a > __exp_limit)))
+	    where(__a > __exp_limit, __r) = __exp_half(__a);
+	  where(isnan(__x), __r) = __a;
+	}
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    cosh(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::cosh(__data(__x));
+}
+
+// }}}
+// tanh {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  tanh(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__tanh(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      // tanh(a) rounds to 1 for larger a (e^-2a < ¼ulp(1)), and expm1(2a)
+      // stays finite
+      constexpr _Tp __one_limit = is_same_v<_Tp, float> ? 9.5f : 19.5;
+      const _V   __a     = abs(__x);
+      const auto __small = __a < _Tp(.625);
+      _V         __r;
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+	__r = __a + __tanhSeries(__a);
+      if (!all_of(__small))
+	{
+	  const _V __e = expm1(__a + __a);
+	  where(!__small, __r) = __e / (__e + 2);
+	  where(__a > __one_limit, __r) = 1;
+	}
+      return __r | (__x & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    tanh(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::tanh(__data(__x));
+}
+
+// }}}
+// }}}
+// frexp {{{
+template <class _Tp, size_t _N> _SimdWrapper<_Tp, _N> __getexp(_SimdWrapper<_Tp, _N> __x)
+{
+    if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>()) {
+        return _mm_getexp_ps(__x);
+    } else if constexpr (__have_avx512f && __is_sse_ps<_Tp, _N>()) {
+        return __lo128(_mm512_getexp_ps(__auto_bitcast(__x)));
+    } else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>()) {
+        return _mm_getexp_pd(__x);
+    } else if constexpr (__have_avx512f && __is_sse_pd<_Tp, _N>()) {
+        return __lo128(_mm512_getexp_pd(__auto_bitcast(__x)));
+    } else if constexpr (__have_avx512vl && __is_avx_ps<_Tp, _N>()) {
+        return _mm256_getexp_ps(__x);
+    } else if constexpr (__have_avx512f && __is_avx_ps<_Tp, _N>()) {
+        return __lo256(_mm512_getexp_ps(__auto_bitcast(__x)));
+    } else if constexpr (__have_avx512vl && __is_avx_pd<_Tp, _N>()) {
+        return _mm256_getexp_pd(__x);
+    } else if constexpr (__have_avx512f && __is_avx_pd<_Tp, _N>()) {
+        return __lo256(_mm512_getexp_pd(__auto_bitcast(__x)));
+    } else if constexpr (__is_avx512_ps<_Tp, _N>()) {
+        return _mm512_getexp_ps(__x);
+    } else if constexpr (__is_avx512_pd<_Tp, _N>()) {
+        return _mm512_getexp_pd(__x);
+    } else {
+        __assert_unreachable<_Tp>();
+    }
+}
+
+#if _GLIBCXX_SIMD_X86INTRIN
+template <class _Tp, size_t _N> _SimdWrapper<_Tp, _N> __getmant_avx512(_SimdWrapper<_Tp, _N> __x)
+{
+    if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>()) {
+        return _mm_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    } else if constexpr (__have_avx512f && __is_sse_ps<_Tp, _N>()) {
+        return __lo128(
+            _mm512_getmant_ps(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+    } else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>()) {
+        return _mm_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    } else if constexpr (__have_avx512f && __is_sse_pd<_Tp, _N>()) {
+        return __lo128(
+            _mm512_getmant_pd(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+    } else if constexpr (__have_avx512vl && __is_avx_ps<_Tp, _N>()) {
+        return _mm256_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    } else if constexpr (__have_avx512f && __is_avx_ps<_Tp, _N>()) {
+        return __lo256(
+            _mm512_getmant_ps(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+    } else if constexpr (__have_avx512vl && __is_avx_pd<_Tp, _N>()) {
+        return _mm256_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    } else if constexpr (__have_avx512f && __is_avx_pd<_Tp, _N>()) {
+        return __lo256(
+            _mm512_getmant_pd(__auto_bitcast(__x), _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+    } else if constexpr (__is_avx512_ps<_Tp, _N>()) {
+        return _mm512_getmant_ps(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    } else if constexpr (__is_avx512_pd<_Tp, _N>()) {
+        return _mm512_getmant_pd(__x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+    } else {
+        __assert_unreachable<_Tp>();
+    }
+}
+#endif // _GLIBCXX_SIMD_X86INTRIN
+
+/**
+ * splits \p __v into exponent and mantissa, the sign is kept with the mantissa
+ *
+ * The return value will be in the range [0.5, 1.0[
+ * The \p __e value will be an integer defining the power-of-two exponent
+ */
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>> frexp(
+    const simd<_Tp, _Abi> &__x, __samesize<int, simd<_Tp, _Abi>> *__exp)
+{
+    if constexpr (simd_size_v<_Tp, _Abi> == 1) {
+        int __tmp;
+        const auto __r = std::frexp(__x[0], &__tmp);
+        (*__exp)[0] = __tmp;
+        return __r;
+    } else if constexpr (__is_fixed_size_abi_v<_Abi>) {
+        return {__private_init, _Abi::_SimdImpl::__frexp(__data(__x), __data(*__exp))};
+#if _GLIBCXX_SIMD_X86INTRIN
+    } else if constexpr (__have_avx512f) {
+        using _IV = __samesize<int, simd<_Tp, _Abi>>;
+        constexpr size_t _N = simd_size_v<_Tp, _Abi>;
+        constexpr size_t NI = _N < 4 ? 4 : _N;
+        const auto __v = __data(__x);
+        const auto __isnonzero = _Abi::_SimdImpl::__isnonzerovalue_mask(__v._M_data);
+        const auto __e =
+            __to_intrin(__blend(__isnonzero, __vector_type_t<int, NI>(),
+                                1 + __convert<_SimdWrapper<int, NI>>(__getexp(__v))._M_data));
+        __vector_store<_N * sizeof(int)>(__e, __exp, overaligned<alignof(_IV)>);
+        return {__private_init, __blend(__isnonzero, __v, __getmant_avx512(__v))};
+#endif // _GLIBCXX_SIMD_X86INTRIN
+    } else {
+        // fallback implementation
+        static_assert(sizeof(_Tp) == 4 || sizeof(_Tp) == 8);
+        using _V = simd<_Tp, _Abi>;
+        using _IV = rebind_simd_t<int, _V>;
+        using _IM = typename _IV::mask_type;
+        using _Limits = std::numeric_limits<_Tp>;
+        using namespace std::experimental::__proposed;
+        using namespace std::experimental::__proposed::float_bitwise_operators;
+
+	constexpr int __exp_shift     = sizeof(_Tp) == 4 ? 23 : 20;
+	constexpr int __exp_adjust    = sizeof(_Tp) == 4 ? 0x7e : 0x3fe;
+	constexpr int __exp_offset    = sizeof(_Tp) == 4 ? 0x70 : 0x200;
+	constexpr _Tp __subnorm_scale = sizeof(_Tp) == 4 ? 0x1p112 : 0x1p512;
+	constexpr _V  __exponent_mask =
+	  _Limits::infinity(); // 0x7f800000 or 0x7ff0000000000000
+	constexpr _V __p5_1_exponent =
+	  _Tp(sizeof(_Tp) == 4 ? -0x1.fffffep-1 : -0x1.fffffffffffffp-1);
+
+	_V __mant = __p5_1_exponent & (__exponent_mask | __x);
+        const _IV __exponent_bits = __extract_exponent_bits(__x);
+        if (_GLIBCXX_SIMD_IS_LIKELY(all_of(isnormal(__x)))) {
+            *__exp = simd_cast<__samesize<int, _V>>((__exponent_bits >> __exp_shift) -
+                                                       __exp_adjust);
+            return __mant;
+        }
+        const auto __iszero_inf_nan = isunordered(__x * _Limits::infinity(), __x * _V());
+        const _V __scaled_subnormal = __x * __subnorm_scale;
+        const _V __mant_subnormal = __p5_1_exponent & (__exponent_mask | __scaled_subnormal);
+        where(!isnormal(__x), __mant) = __mant_subnormal;
+        where(__iszero_inf_nan, __mant) = __x;
+        _IV __e = __extract_exponent_bits(__scaled_subnormal);
+        const _IM __value_isnormal = static_simd_cast<_IM>(isnormal(__x));
+        where(__value_isnormal, __e) = __exponent_bits;
+        const _IV __offset = (simd_reinterpret_cast<_IV>(__value_isnormal) & _IV(__exp_adjust)) |
+                          (simd_reinterpret_cast<_IV>((__exponent_bits == 0) &
+                                                     (static_simd_cast<_IM>(__x != 0))) &
+                           _IV(__exp_adjust + __exp_offset));
+        *__exp = simd_cast<__samesize<int, _V>>((__e >> __exp_shift) - __offset);
+        return __mant;
+    }
+}
+// }}}
+// ldexp, scalbn, scalbln {{{
+/*
+ * algorithm for x * 2^n:
+ *
+ * If n is not in the range of normal exponents, at most two
+ * multiplications with 2^(max_exponent - 1) or 2^(min_exponent - 1 +
+ * digits) move it there. These are exact unless the result overflows or is
+ * too small to round to anything but zero (or the smallest subnormal)
+ * anyway. The final multiplication with the normal power of two 2^n is the
+ * only one that rounds, thus subnormal results are correctly rounded.
+ */
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  ldexp(const simd<_Tp, _Abi>&                               __x,
+	const fixed_size_simd<int, simd_size_v<_Tp, _Abi>>& __exp)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__ldexp(__data(__x), __data(__exp))};
+    }
+  else
+    {
+      using _Limits         = std::numeric_limits<_Tp>;
+      constexpr int __e_max = _Limits::max_exponent - 1;
+      constexpr int __e_min = _Limits::min_exponent - 1;
+      _V __n = static_simd_cast<_V>(__exp);
+      if (_GLIBCXX_SIMD_IS_LIKELY(all_of(__n >= __e_min && __n <= __e_max)))
+	return __x * __make_pow2(__n);
+      _V __y = __x;
+      for (int __i = 0; __i < 2; ++__i)
+	{
+	  const auto __large = __n > __e_max;
+	  where(__large, __y) *= __make_pow2(_V(__e_max));
+	  where(__large, __n) -= __e_max;
+	  const auto __small = __n < __e_min;
+	  where(__small, __y) *= __make_pow2(_V(__e_min + _Limits::digits));
+	  where(__small, __n) -= __e_min + _Limits::digits;
+	}
+      return __y * __make_pow2(clamp(__n, _V(__e_min), _V(__e_max)));
+    }
+}
+
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC
+  enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  scalbn(const simd<_Tp, _Abi>&                               __x,
+	 const fixed_size_simd<int, simd_size_v<_Tp, _Abi>>& __exp)
+{
+  // FLT_RADIX is 2
+  return std::experimental::ldexp(__x, __exp);
+}
+
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC
+  enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  scalbln(const simd<_Tp, _Abi>&                                __x,
+	  const fixed_size_simd<long, simd_size_v<_Tp, _Abi>>& __exp)
+{
+  // any exponent beyond the int range overflows or underflows
+  using _LV = fixed_size_simd<long, simd_size_v<_Tp, _Abi>>;
+  return std::experimental::ldexp(
+    __x, static_simd_cast<fixed_size_simd<int, simd_size_v<_Tp, _Abi>>>(
+	   clamp(__exp, _LV(std::numeric_limits<int>::min()),
+		 _LV(std::numeric_limits<int>::max()))));
+}
+
+// }}}
+_GLIBCXX_SIMD_MATH_CALL_(ilogb)
+
+// logarithms {{{
+/*
+ * algorithm for the logarithm functions:
+ *
+ * Split x into (1 + m) * 2^e with m in [√½ - 1, √2 - 1).
+ * log(x)   = e * ln2 + log(1 + m)
+ * log2(x)  = e + log(1 + m) * log2(e)
+ * log10(x) = e * log10(2) + log(1 + m) * log10(e)
+ * log(1 + m) is calculated as m + __logSeries(m), i.e. the polynomial only
+ * contributes the (smaller) non-linear part. The constant factors are split
+ * into a short (exactly multipliable) high part and a low part.
+ */
+namespace __math_float
+{
+inline constexpr float __sqrt_half  = 0x1.6a09e6p-1f;     // √½
+inline constexpr float __log2e_m1   = 0x1.c551dap-2f;     // log2(e) - 1
+inline constexpr float __log10e_hi  = 0x1.bc0000p-2f;     // log10(e), 7 bits
+inline constexpr float __log10e_lo  = 0x1.6f62a4p-11f;    // log10(e) - __log10e_hi
+inline constexpr float __log10_2_hi = 0x1.340000p-2f;     // log10(2), 7 bits
+inline constexpr float __log10_2_lo = 0x1.04d428p-12f;    // log10(2) - __log10_2_hi
+}
+namespace __math_double
+{
+inline constexpr double __sqrt_half  = 0x1.6a09e667f3bcdp-1;  // √½
+inline constexpr double __log2e_m1   = 0x1.c551d94ae0bf8p-2;  // log2(e) - 1
+inline constexpr double __log10e_hi  = 0x1.bc00000000000p-2;  // log10(e), 7 bits
+inline constexpr double __log10e_lo  = 0x1.6f62a4dca1c65p-11; // log10(e) - __log10e_hi
+inline constexpr double __log10_2_hi = 0x1.3400000000000p-2;  // log10(2), 7 bits
+inline constexpr double __log10_2_lo = 0x1.04d427de7fbccp-12; // log10(2) - __log10_2_hi
+}
+
+// __logSeries {{{
+/**\internal
+ * Approximates log(1 + x) - x for x in [√½ - 1, √2 - 1).
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __logSeries(const simd<float, _Abi>& __x)
+{
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = 0x1.204376p-4f;
+  __y = __y * __x - 0x1.d7a370p-4f;
+  __y = __y * __x + 0x1.de4a34p-4f;
+  __y = __y * __x - 0x1.fcba9ep-4f;
+  __y = __y * __x + 0x1.23d37ep-3f;
+  __y = __y * __x - 0x1.555ca0p-3f;
+  __y = __y * __x + 0x1.999d58p-3f;
+  __y = __y * __x - 0x1.fffff8p-3f;
+  __y = __y * __x + 0x1.555554p-2f;
+  return __y * __x * __x2 - .5f * __x2;
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __logSeries(const simd<double, _Abi>& __x)
+{
+  // rational approximation: log(1 + x) - x ≈ x³P(x) / Q(x) - ½x²
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __p, __q;
+  __p = 0x1.ab4c293c31bb0p-14;
+  __p = __p * __x + 0x1.fd6f53f5652f2p-2;
+  __p = __p * __x + 0x1.2d2baed926911p+2;
+  __p = __p * __x + 0x1.cff72c63eeb2ep+3;
+  __p = __p * __x + 0x1.1efd6924bc84dp+4;
+  __p = __p * __x + 0x1.ed5637d7edcf8p+2;
+  __q = __x + 0x1.69320ae97ef8ep+3;
+  __q = __q * __x + 0x1.69d2c4e19c033p+5;
+  __q = __q * __x + 0x1.4bf33a326bdbdp+6;
+  __q = __q * __x + 0x1.1c9e2eb5eae21p+6;
+  __q = __q * __x + 0x1.7200a9e1f25b2p+4;
+  return __x * __x2 * __p / __q - .5 * __x2;
+}
+
+// }}}
+// __split_mantissa {{{
+/**\internal
+ * Splits positive, finite \p __x into `(1 + _M_m) * 2^_M_e` with integral
+ * `_M_e` and `_M_m` in [√½ - 1, √2 - 1). Subnormals are supported. Other
+ * inputs yield unspecified values.
+ */
+template <class _Tp, class _Abi>
+struct __mantissa_split
+{
+  simd<_Tp, _Abi> _M_m;
+  simd<_Tp, _Abi> _M_e;
+};
+
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC __mantissa_split<_Tp, _Abi>
+			__split_mantissa(const simd<_Tp, _Abi>& __x)
+{
+  using _V      = simd<_Tp, _Abi>;
+  using _Limits = std::numeric_limits<_Tp>;
+  constexpr _Tp __sqrt_half =
+    sizeof(_Tp) == 4 ? __math_float::__sqrt_half : __math_double::__sqrt_half;
+  if constexpr (__have_avx512f && __is_fixed_size_abi_v<_Abi>)
+    {
+      // getmant and getexp per native chunk
+      const auto __split = [](auto __impl, auto __xx) {
+	using _Vn = typename decltype(__impl)::simd_type;
+	return __split_mantissa(_Vn(__private_init, __xx));
+      };
+      return {_V(__private_init,
+		 __data(__x).__apply_per_chunk([&](auto __impl, auto __xx) {
+		   return __data(__split(__impl, __xx)._M_m);
+		 })),
+	      _V(__private_init,
+		 __data(__x).__apply_per_chunk([&](auto __impl, auto __xx) {
+		   return __data(__split(__impl, __xx)._M_e);
+		 }))};
+    }
+  __mantissa_split<_Tp, _Abi> __r;
+  _V                          __m; // in [½, 1)
+#if _GLIBCXX_SIMD_X86INTRIN
+  if constexpr (__have_avx512f && !__is_fixed_size_abi_v<_Abi> &&
+		!__is_abi<_Abi, simd_abi::scalar>())
+    {
+      __m      = _V(__private_init, __getmant_avx512(__data(__x)));
+      __r._M_e = _V(__private_init, __getexp(__data(__x))) + 1;
+    }
+  else
+#endif // _GLIBCXX_SIMD_X86INTRIN
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      constexpr int __exp_shift  = sizeof(_Tp) == 4 ? 23 : 20;
+      constexpr int __exp_adjust = sizeof(_Tp) == 4 ? 0x7e : 0x3fe;
+      constexpr _V  __exponent_mask = _Limits::infinity();
+      constexpr _V  __p5_1_exponent =
+	_Tp(sizeof(_Tp) == 4 ? 0x1.fffffep-1 : 0x1.fffffffffffffp-1);
+      _V __xn = __x;
+      _V __e_adjust = 0;
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(__x < _Limits::min())))
+	{
+	  // normalize subnormals
+	  const auto __subnormal = __x < _Limits::min();
+	  where(__subnormal, __xn) *= _Tp(1ull << (_Limits::digits - 1));
+	  where(__subnormal, __e_adjust) = _Limits::digits - 1;
+	}
+      __m      = __p5_1_exponent & (__exponent_mask | __xn);
+      __r._M_e = static_simd_cast<_V>(
+		   (__extract_exponent_bits(__xn) >> __exp_shift) - __exp_adjust)
+		 - __e_adjust;
+    }
+  const auto __small = __m < __sqrt_half;
+  where(__small, __m) += __m;
+  where(__small, __r._M_e) -= 1;
+  __r._M_m = __m - 1;
+  return __r;
+}
+
+// }}}
+// __log_fixup {{{
+/**\internal
+ * Applies the special cases of log(\p __x) to \p __r: -∞ for ±0, NaN for
+ * negative inputs, and identity for +∞ and NaN.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> __log_fixup(const simd<_Tp, _Abi>& __x,
+						    simd<_Tp, _Abi>        __r)
+{
+  using _Limits = std::numeric_limits<_Tp>;
+  if (_GLIBCXX_SIMD_IS_UNLIKELY(
+	!all_of(__x > 0 && __x < _Limits::infinity())))
+    {
+      where(__x == 0, __r) = -_Limits::infinity();
+      where(__x < 0, __r)  = _Limits::quiet_NaN();
+      where(isnan(__x) || __x == _Limits::infinity(), __r) = __x;
+    }
+  return __r;
+}
+
+// }}}
+// log {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  log(const simd<_Tp, _Abi>& __x)
+{
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__log(__data(__x))};
+    }
+  else
+    {
+      constexpr _Tp __ln2_hi =
+	sizeof(_Tp) == 4 ? __math_float::__ln2_hi : __math_double::__ln2_hi;
+      constexpr _Tp __ln2_lo =
+	sizeof(_Tp) == 4 ? __math_float::__ln2_lo : __math_double::__ln2_lo;
+      const auto __s = __split_mantissa(__x);
+      return __log_fixup(__x, ((__logSeries(__s._M_m) + __s._M_e * __ln2_lo) +
+			       __s._M_m) +
+				__s._M_e * __ln2_hi);
+    }
+}
+
+// }}}
+// log2 {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  log2(const simd<_Tp, _Abi>& __x)
+{
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__log2(__data(__x))};
+    }
+  else
+    {
+      constexpr _Tp __log2e_m1 = sizeof(_Tp) == 4 ? __math_float::__log2e_m1
+						   : __math_double::__log2e_m1;
+      const auto __s = __split_mantissa(__x);
+      const auto __y = __logSeries(__s._M_m);
+      // (m + y) * log2(e) = (m + y) * (log2(e) - 1) + y + m
+      return __log_fixup(__x, __y * __log2e_m1 + __s._M_m * __log2e_m1 + __y +
+				__s._M_m + __s._M_e);
+    }
+}
+
+// }}}
+// log10 {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  log10(const simd<_Tp, _Abi>& __x)
+{
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__log10(__data(__x))};
+    }
+  else
+    {
+      constexpr bool __f = sizeof(_Tp) == 4;
+      constexpr _Tp  __log10e_hi =
+	__f ? __math_float::__log10e_hi : __math_double::__log10e_hi;
+      constexpr _Tp __log10e_lo =
+	__f ? __math_float::__log10e_lo : __math_double::__log10e_lo;
+      constexpr _Tp __log10_2_hi =
+	__f ? __math_float::__log10_2_hi : __math_double::__log10_2_hi;
+      constexpr _Tp __log10_2_lo =
+	__f ? __math_float::__log10_2_lo : __math_double::__log10_2_lo;
+      const auto __s = __split_mantissa(__x);
+      const auto __y = __logSeries(__s._M_m);
+      // __m_hi * __log10e_hi is exact
+      const auto __m_hi =
+	__zero_low_bits<std::numeric_limits<_Tp>::digits / 2>(__s._M_m);
+      return __log_fixup(__x, __y * __log10e_lo + __s._M_m * __log10e_lo +
+				__s._M_e * __log10_2_lo + __y * __log10e_hi +
+				(__s._M_m - __m_hi) * __log10e_hi +
+				__m_hi * __log10e_hi + __s._M_e * __log10_2_hi);
+    }
+}
+
+// }}}
+// log1p {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  log1p(const simd<_Tp, _Abi>& __x)
+{
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__log1p(__data(__x))};
+    }
+  else
+    {
+      using _V      = simd<_Tp, _Abi>;
+      using _Limits = std::numeric_limits<_Tp>;
+      constexpr _Tp __ln2_hi =
+	sizeof(_Tp) == 4 ? __math_float::__ln2_hi : __math_double::__ln2_hi;
+      constexpr _Tp __ln2_lo =
+	sizeof(_Tp) == 4 ? __math_float::__ln2_lo : __math_double::__ln2_lo;
+      const _V   __u = 1 + __x;
+      const auto __s = __split_mantissa(__u);
+      // log(1 + x) = log(u) + log(1 + c/u) with c = x - (u - 1), the rounding
+      // error of u; log(1 + c/u) ≈ c/u since |c/u| ≤ 1ulp.
+      // For e = 0 the reduction is not needed: use x directly.
+      const auto __direct = __s._M_e == 0;
+      _V         __m      = __s._M_m;
+      _V         __c      = (__x - (__u - 1)) / __u;
+      where(__direct, __m) = __x;
+      where(__direct, __c) = 0;
+      _V __r = ((__logSeries(__m) + __s._M_e * __ln2_lo) + __c + __m) +
+	       __s._M_e * __ln2_hi;
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(
+	    !all_of(__u > 0 && __u < _Limits::infinity())))
+	{
+	  // 1 + x can overflow for finite x if rounding upwards
+	  where(__u == _Limits::infinity(), __r) = log(__x);
+	  where(__u == 0, __r)                   = -_Limits::infinity();
+	  where(__u < 0, __r)                    = _Limits::quiet_NaN();
+	  where(isnan(__x), __r)                 = __x;
+	}
+      return __r;
+    }
+}
+
+// }}}
+//}}}
+// inverse hyperbolic functions {{{
+/*
+ * algorithm for asinh, acosh, and atanh:
+ *
+ * With a = |x| (acosh: a = x):
+ * asinh(a) = log1p(a + a² / (1 + √(1 + a²)))   for a < 2
+ *          = log(2a + 1 / (a + √(a² + 1)))     otherwise
+ * acosh(a) = log1p(t + √(2t + t²)), t = a - 1  for a < 2 (t is exact)
+ *          = log(2a - 1 / (a + √(a² - 1)))     otherwise
+ * atanh(a) = ½ log1p(2a + 2a² / (1 - a))       for a < ½
+ *          = ½ log1p(2a / (1 - a))             otherwise (1 - a is exact)
+ *
+ * The log1p forms avoid the cancellation of log(1 + small). If a² overflows,
+ * the correction term of the log form becomes 0, which is below ½ulp(2a)
+ * anyway. 2a is exact unless it overflows, which is only possible for
+ * a > max/2; these use log(a) + ln2.
+ *
+ * ±0, ±inf, NaN, and the domain errors follow from log, log1p, and sqrt,
+ * except for acosh(x < 1) (sqrt(2t + t²) is not NaN for t <= -2).
+ */
+// asinh {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  asinh(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__asinh(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      using _Limits      = std::numeric_limits<_Tp>;
+      const _V   __a     = abs(__x);
+      const auto __small = __a < 2;
+      _V         __r     = 0; // each branch below writes only its lanes
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+	{
+	  const _V __a2 = __a * __a;
+	  __r           = log1p(__a + __a2 / (1 + sqrt(1 + __a2)));
+	}
+      if (!all_of(__small))
+	{
+	  where(!__small, __r) =
+	    log(__a + __a + 1 / (__a + sqrt(__a * __a + 1)));
+	  const auto __huge = __a > _Limits::max() * _Tp(.5);
+	  if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(__huge)))
+	    where(__huge, __r) = log(__a) + _Tp(__math_double::__ln2);
+	}
+      return __r | (__x & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    asinh(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::asinh(__data(__x));
+}
+
+// }}}
+// acosh {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  acosh(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__acosh(__data(__x))};
+    }
+  else
+    {
+      using _Limits      = std::numeric_limits<_Tp>;
+      const auto __small = __x < 2;
+      _V         __r     = 0; // each branch below writes only its lanes
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+	{
+	  const _V __t = __x - 1;
+	  __r          = log1p(__t + sqrt(__t * __t + (__t + __t)));
+	  where(__x < 1, __r) = _Limits::quiet_NaN();
+	}
+      if (!all_of(__small))
+	{
+	  // NaN inputs end up here
+	  where(!__small, __r) =
+	    log(__x + __x - 1 / (__x + sqrt(__x * __x - 1)));
+	  const auto __huge = __x > _Limits::max() * _Tp(.5);
+	  if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(__huge)))
+	    where(__huge, __r) = log(__x) + _Tp(__math_double::__ln2);
+	}
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    acosh(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::acosh(__data(__x));
+}
+
+// }}}
+// atanh {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  atanh(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__atanh(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      const _V   __a     = abs(__x);
+      const auto __small = __a < _Tp(.5);
+      // a = 1 yields log1p(+inf), a > 1 yields log1p(x < -1) = NaN
+      _V __t = (__a + __a) / (1 - __a);
+      where(__small, __t) = __a + __a + (__a + __a) * __a / (1 - __a);
+      return (_Tp(.5) * log1p(__t)) | (__x & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    atanh(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::atanh(__data(__x));
+}
+
+// }}}
+// }}}
+//logb{{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, _Abi>> logb(
+    const simd<_Tp, _Abi> &__x)
+{
+    constexpr size_t _N = simd_size_v<_Tp, _Abi>;
+    if constexpr (_N == 1) {
+        return std::logb(__x[0]);
+    } else if constexpr (__is_fixed_size_abi_v<_Abi> &&
+			 (__math_per_chunk<_Tp, _Abi>() || __have_avx512f)) {
+	// with AVX-512 every native chunk is a single getexp instruction
+	return {__private_init,
+		__data(__x).__apply_per_chunk([](auto __impl, auto __xx) {
+		  using _V = typename decltype(__impl)::simd_type;
+		  return __data(
+		    std::experimental::logb(_V(__private_init, __xx)));
+		})};
+      }
+    else if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>())
+      {
+	return {__private_init, _mm_getexp_ps(__data(__x))};
+      }
+    else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>())
+      {
+	return {__private_init, _mm_getexp_pd(__data(__x))};
+      }
     else if constexpr (__have_avx512vl && __is_avx_ps<_Tp, _N>())
       {
 	return {__private_init, _mm256_getexp_ps(__data(__x))};
@@ -789,527 +2440,3064 @@ enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, _Abi>> logb(
 	using namespace std::experimental::__proposed;
 	auto __is_normal = isnormal(__x);
 
-	// work on __abs(__x) to reflect the return value on Linux for negative
-	// inputs (domain-error => implementation-defined value is returned)
-	const _V abs_x = abs(__x);
+	// work on __abs(__x) to reflect the return value on Linux for negative
+	// inputs (domain-error => implementation-defined value is returned)
+	const _V abs_x = abs(__x);
+
+	// __exponent(__x) returns the exponent value (bias removed) of
+	// positive __x. The biased exponent is shifted into the low mantissa
+	// bits of 2^(digits-1), which is subtracted again; this avoids a
+	// (scalarized) 64-bit integer to double conversion.
+	auto&& __exponent = [](const _V& __v) {
+	  using namespace std::experimental::__proposed;
+	  using _UV = rebind_simd_t<
+	    std::make_unsigned_t<__int_for_sizeof_t<_Tp>>, _V>;
+	  constexpr int __mant_bits = std::numeric_limits<_Tp>::digits - 1;
+	  constexpr _Tp __shifter   = _Tp(1ull << __mant_bits);
+	  return simd_reinterpret_cast<_V>(
+		   (simd_reinterpret_cast<_UV>(__v) >> __mant_bits)
+		   | simd_reinterpret_cast<_UV>(_V(__shifter)))
+		 - (__shifter + (std::numeric_limits<_Tp>::max_exponent - 1));
+	};
+	_V __r = __exponent(abs_x);
+	if (_GLIBCXX_SIMD_IS_LIKELY(all_of(__is_normal)))
+	  {
+	    // without corner cases (nan, inf, subnormal, zero) we have our
+	    // answer:
+	    return __r;
+	  }
+	const auto __is_zero  = __x == 0;
+	const auto __is_nan   = isnan(__x);
+	const auto __is_inf   = isinf(__x);
+	where(__is_zero, __r) = -std::numeric_limits<_Tp>::infinity();
+	where(__is_nan, __r)  = __x;
+	where(__is_inf, __r)  = std::numeric_limits<_Tp>::infinity();
+	__is_normal |= __is_zero || __is_nan || __is_inf;
+	if (all_of(__is_normal))
+	  {
+	    // at this point everything but subnormals is handled
+	    return __r;
+	  }
+	// subnormals repeat the exponent extraction after multiplication of the
+	// input with __a floating point value that has 112 (0x70) in its exponent
+	// (not too big for sp and large enough for dp)
+	const _V __scaled = abs_x * _Tp(0x1p112);
+	_V __scaled_exp   = __exponent(__scaled) - 112;
+	where(__is_normal, __scaled_exp) = __r;
+	return __scaled_exp;
+      }
+}
+//}}}
+template <typename _Tp, typename _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  modf(const simd<_Tp, _Abi>& __x, simd<_Tp, _Abi>* __iptr)
+{
+  const auto __integral = trunc(__x);
+  *__iptr = __integral;
+  auto __r = __x - __integral;
+  where(isinf(__x), __r) = _Tp();
+  return copysign(__r, __x);
+}
+
+
+// cbrt {{{
+/*
+ * algorithm for cbrt:
+ *
+ * Split |x| into (1 + m) 2^e (__split_mantissa) and e into 3q + r with
+ * r ∈ {-1, 0, 1}. Then cbrt(x) = ±2^q cbrt(y) with y = (1 + m) 2^r (exact).
+ *
+ * __cbrtSeries approximates cbrt(1 + m) to 13 (float) or 22 (double) bits.
+ * Times cbrt(2^r) this is the start value t. Chopping t to half the mantissa
+ * makes t² exact and a single Halley step (as in fdlibm)
+ * t' = t + t (y/t² - t) / (2t + y/t²)
+ * triples the number of correct bits.
+ */
+// __cbrtSeries {{{
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<float, _Abi>
+  __cbrtSeries(const simd<float, _Abi>& __m)
+{
+  simd<float, _Abi> __p;
+  __p = 0x1.c934ap-5f;
+  __p = __p * __m - 0x1.d82614p-4f;
+  __p = __p * __m + 0x1.55d5p-2f;
+  return __p * __m + 0x1.0003a6p+0f;
+}
+
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<double, _Abi>
+  __cbrtSeries(const simd<double, _Abi>& __m)
+{
+  simd<double, _Abi> __p;
+  __p = -0x1.3bac61f396edbp-6;
+  __p = __p * __m + 0x1.0ec10a9e54252p-5;
+  __p = __p * __m - 0x1.57c1ea6c7116bp-5;
+  __p = __p * __m + 0x1.f8b22e201632dp-5;
+  __p = __p * __m - 0x1.c6fcb4d31f4c8p-4;
+  __p = __p * __m + 0x1.5555aea4953e5p-2;
+  return __p * __m + 0x1.fffffabc91eddp-1;
+}
+
+// }}}
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  cbrt(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__cbrt(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      constexpr bool __f32      = sizeof(_Tp) == 4;
+      constexpr _Tp  __cbrt2    = __f32 ? 0x1.428a3p+0f : 0x1.428a2f98d728bp+0;
+      constexpr _Tp  __cbrt_1_2 = __f32 ? 0x1.965feap-1f : 0x1.965fea53d6e3dp-1;
+      const auto __split = __split_mantissa(abs(__x));
+      // e / 3 is never close to ½ + n, thus the rounded product suffices
+      const _V __q = round(__split._M_e * _Tp(1. / 3));
+      const _V __r = __split._M_e - 3 * __q;
+      _V       __y = 1 + __split._M_m;
+      _V       __t = __cbrtSeries(__split._M_m);
+      where(__r > 0, __y) *= 2;
+      where(__r > 0, __t) *= __cbrt2;
+      where(__r < 0, __y) *= _Tp(.5);
+      where(__r < 0, __t) *= __cbrt_1_2;
+      __t = __zero_low_bits<__f32 ? 12 : 32>(__t);
+      const _V __s = __y / (__t * __t);
+      __t += __t * ((__s - __t) / (__t + __t + __s));
+      _V __res = (__t * __make_pow2(__q)) | (__x & _V(_Tp(-0.)));
+      // ±0, ±inf, and NaN
+      where(__x == 0 || !isfinite(__x), __res) = __x;
+      return __res;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    cbrt(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::cbrt(__data(__x));
+}
+
+// }}}
+
+_GLIBCXX_SIMD_MATH_CALL_(abs)
+_GLIBCXX_SIMD_MATH_CALL_(fabs)
+
+// [parallel.simd.math] only asks for is_floating_point_v<_Tp> and forgot to allow
+// signed integral _Tp
+template <class _Tp, class _Abi>
+enable_if_t<!std::is_floating_point_v<_Tp> && std::is_signed_v<_Tp>, simd<_Tp, _Abi>> abs(
+    const simd<_Tp, _Abi> &__x)
+{
+    return {__private_init, _Abi::_SimdImpl::__abs(__data(__x))};
+}
+template <class _Tp, class _Abi>
+enable_if_t<!std::is_floating_point_v<_Tp> && std::is_signed_v<_Tp>, simd<_Tp, _Abi>> fabs(
+    const simd<_Tp, _Abi> &__x)
+{
+    return {__private_init, _Abi::_SimdImpl::__abs(__data(__x))};
+}
+
+// the following are overloads for functions in <cstdlib> and not covered by
+// [parallel.simd.math]. I don't see much value in making them work, though
+/*
+template <class _Abi> simd<long, _Abi> labs(const simd<long, _Abi> &__x)
+{
+    return {__private_init, _Abi::_SimdImpl::abs(__data(__x))};
+}
+template <class _Abi> simd<long long, _Abi> llabs(const simd<long long, _Abi> &__x)
+{
+    return {__private_init, _Abi::_SimdImpl::abs(__data(__x))};
+}
+*/
+
+template <typename _R, typename _ToApply, typename _Tp, typename... _Tps>
+_GLIBCXX_SIMD_INTRINSIC _R __fixed_size_apply(_ToApply&& __apply,
+					      const _Tp& __arg0,
+					      const _Tps&... __args)
+{
+  return {__private_init, __data(__arg0).__apply_per_chunk(
+			    [&](auto __impl, const auto&... __inner) {
+			      using _V = typename decltype(__impl)::simd_type;
+			      return __data(__apply(_V(__private_init, __inner)...));
+			    },
+			    __data(__args)...)};
+}
+
+template <typename _VV> __remove_cvref_t<_VV> __hypot(_VV __x, _VV __y)
+{
+  using _V = __remove_cvref_t<_VV>;
+  using _Tp = typename _V::value_type;
+  if constexpr (_V::size() == 1)
+    {
+      return std::hypot(_Tp(__x[0]), _Tp(__y[0]));
+    }
+  else if constexpr (__is_fixed_size_abi_v<typename _V::abi_type>)
+    {
+      return __fixed_size_apply<_V>(
+	[](auto __a, auto __b) { return hypot(__a, __b); }, __x, __y);
+    }
+  else
+    {
+      // A simple solution for _Tp == float would be to cast to double and simply calculate
+      // sqrt(x²+y²) as it can't over-/underflow anymore with dp. It still needs the Annex F fixups
+      // though and isn't faster on Skylake-AVX512 (not even for SSE and AVX vectors, and really bad
+      // for AVX-512).
+      using namespace __proposed::float_bitwise_operators;
+      using _Limits = std::numeric_limits<_Tp>;
+      _V __absx     = abs(__x);            // no error
+      _V __absy     = abs(__y);            // no error
+      _V __hi       = max(__absx, __absy); // no error
+      _V __lo       = min(__absy, __absx); // no error
+
+      // round __hi down to the next power-of-2:
+      constexpr _V __inf(_Limits::infinity());
+
+      if (_GLIBCXX_SIMD_IS_LIKELY(all_of(isnormal(__x)) &&
+				  all_of(isnormal(__y))))
+	{
+	  const _V     __hi_exp    = __hi & __inf;
+	  //((__hi + __hi) & __inf) ^ __inf almost works for computing __scale, except
+	  //when (__hi + __hi) & __inf == __inf, in which case __scale becomes 0 (should
+	  //be min/2 instead) and thus loses the information from __lo.
+	  const _V     __scale     = (__hi_exp ^ __inf) * _Tp(.5);
+	  constexpr _V __mant_mask = _Limits::min() - _Limits::denorm_min();
+	  const _V     __h1        = (__hi & __mant_mask) | _V(1);
+	  const _V     __l1        = __lo * __scale;
+	  return __hi_exp * sqrt(__h1 * __h1 + __l1 * __l1);
+	}
+      else
+	{
+	  // slower path to support subnormals
+	  // if __hi is subnormal, avoid scaling by inf & final mul by 0 (which
+	  // yields NaN) by using min()
+	  _V __scale = _V(1 / _Limits::min());
+	  // invert exponent w/o error and w/o using the slow divider unit:
+	  // xor inverts the exponent but off by 1. Multiplication with .5
+	  // adjusts for the discrepancy.
+	  where(__hi >= _Limits::min(), __scale) =
+	    ((__hi & __inf) ^ __inf) * _Tp(.5);
+	  // adjust final exponent for subnormal inputs
+	  _V __hi_exp                             = _Limits::min();
+	  where(__hi >= _Limits::min(), __hi_exp) = __hi & __inf; // no error
+	  _V __h1 = __hi * __scale; // no error
+	  _V __l1 = __lo * __scale; // no error
+
+	  // sqrt(x²+y²) = e*sqrt((x/e)²+(y/e)²):
+	  // this ensures no overflow in the argument to sqrt
+	  _V __r = __hi_exp * sqrt(__h1 * __h1 + __l1 * __l1);
+#ifdef __STDC_IEC_559__
+	  // fixup for Annex F requirements
+	  // the naive fixup goes like this:
+	  //
+	  // where(__l1 == 0, __r)                      = __hi;
+	  // where(isunordered(__x, __y), __r)          = _Limits::quiet_NaN();
+	  // where(isinf(__absx) || isinf(__absy), __r) = __inf;
+	  //
+	  // The fixup can be prepared in parallel with the sqrt, requiring a single blend
+	  // step after hi_exp * sqrt, reducing latency and throughput:
+	  _V __fixup                                     = __hi; // __lo == 0
+	  where(isunordered(__x, __y), __fixup)          = _Limits::quiet_NaN();
+	  where(isinf(__absx) || isinf(__absy), __fixup) = __inf;
+	  where(!(__lo == 0 || isunordered(__x, __y) ||
+		  (isinf(__absx) || isinf(__absy))),
+		__fixup)                                 = __r;
+	  __r                                            = __fixup;
+#endif
+	  return __r;
+	}
+    }
+}
+
+template <typename _Tp, typename _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+			hypot(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+{
+  return __hypot<conditional_t<__is_fixed_size_abi_v<_Abi>,
+			       const simd<_Tp, _Abi>&, simd<_Tp, _Abi>>>(__x,
+									 __y);
+}
+_GLIBCXX_SIMD_CVTING2(hypot)
+
+template <typename _VV> __remove_cvref_t<_VV> __hypot(_VV __x, _VV __y, _VV __z)
+{
+  using _V = __remove_cvref_t<_VV>;
+  using _Abi = typename _V::abi_type;
+  using _Tp = typename _V::value_type;
+  /* FIXME: enable after PR77776 is resolved
+  if constexpr (_V::size() == 1)
+    {
+      return std::hypot(_Tp(__x[0]), _Tp(__y[0]), _Tp(__z[0]));
+    }
+  else
+  */
+  if constexpr (__is_fixed_size_abi_v<_Abi> && _V::size() > 1)
+    {
+      return __fixed_size_apply<simd<_Tp, _Abi>>(
+	[](auto __a, auto __b, auto __c) { return hypot(__a, __b, __c); }, __x,
+	__y, __z);
+    }
+  else
+    {
+      using namespace __proposed::float_bitwise_operators;
+      using _Limits = std::numeric_limits<_Tp>;
+      const _V __absx     = abs(__x);                         // no error
+      const _V __absy     = abs(__y);                         // no error
+      const _V __absz     = abs(__z);                         // no error
+      _V __hi       = max(max(__absx, __absy), __absz); // no error
+      _V __l0       = min(__absz, max(__absx, __absy)); // no error
+      _V __l1       = min(__absy, __absx);              // no error
+      if constexpr (numeric_limits<_Tp>::digits == 64 &&
+		    numeric_limits<_Tp>::max_exponent == 0x4000 &&
+		    numeric_limits<_Tp>::min_exponent == -0x3FFD &&
+		    _V::size() == 1)
+	{ // Seems like x87 fp80, where bit 63 is always 1 unless subnormal or
+	  // NaN. In this case the bit-tricks don't work, they require IEC559
+	  // binary32 or binary64 format.
+#ifdef __STDC_IEC_559__
+	  // fixup for Annex F requirements
+	  if (isinf(__absx[0]) || isinf(__absy[0]) || isinf(__absz[0]))
+	    return _Limits::infinity();
+	  else if (isunordered(__absx[0], __absy[0]+__absz[0]))
+	    return _Limits::quiet_NaN();
+	  else if (__l0[0] == 0 && __l1[0] == 0)
+	    return __hi;
+#endif
+	  _V            __hi_exp = __hi;
+	  const _ULLong __tmp    = 0x8000'0000'0000'0000ull;
+	  std::memcpy(&__hi_exp, &__tmp, 8);
+	  const _V __scale = 1 / __hi_exp;
+	  __hi *= __scale;
+	  __l0 *= __scale;
+	  __l1 *= __scale;
+	  return __hi_exp * sqrt((__l0 * __l0 + __l1 * __l1) + __hi * __hi);
+	}
+      else
+	{
+	  // round __hi down to the next power-of-2:
+	  constexpr _V __inf(_Limits::infinity());
+
+	  if (_GLIBCXX_SIMD_IS_LIKELY(all_of(isnormal(__x)) &&
+				      all_of(isnormal(__y)) &&
+				      all_of(isnormal(__z))))
+	    {
+	      const _V __hi_exp = __hi & __inf;
+	      //((__hi + __hi) & __inf) ^ __inf almost works for computing
+	      //__scale, except when (__hi + __hi) & __inf == __inf, in which
+	      // case __scale
+	      // becomes 0 (should be min/2 instead) and thus loses the
+	      // information from __lo.
+	      const _V     __scale     = (__hi_exp ^ __inf) * _Tp(.5);
+	      constexpr _V __mant_mask = _Limits::min() - _Limits::denorm_min();
+	      const _V     __h1        = (__hi & __mant_mask) | _V(1);
+	      __l0 *= __scale;
+	      __l1 *= __scale;
+	      const _V __lo =
+		__l0 * __l0 + __l1 * __l1; // add the two smaller values first
+	      return __hi_exp * sqrt(__lo + __h1 * __h1);
+	    }
+	  else
+	    {
+	      // slower path to support subnormals
+	      // if __hi is subnormal, avoid scaling by inf & final mul by 0
+	      // (which yields NaN) by using min()
+	      _V __scale = _V(1 / _Limits::min());
+	      // invert exponent w/o error and w/o using the slow divider unit:
+	      // xor inverts the exponent but off by 1. Multiplication with .5
+	      // adjusts for the discrepancy.
+	      where(__hi >= _Limits::min(), __scale) =
+		((__hi & __inf) ^ __inf) * _Tp(.5);
+	      // adjust final exponent for subnormal inputs
+	      _V __hi_exp = _Limits::min();
+	      where(__hi >= _Limits::min(), __hi_exp) =
+		__hi & __inf;           // no error
+	      _V __h1 = __hi * __scale; // no error
+	      __l0 *= __scale;          // no error
+	      __l1 *= __scale;          // no error
+	      _V __lo =
+		__l0 * __l0 + __l1 * __l1; // add the two smaller values first
+	      _V __r = __hi_exp * sqrt(__lo + __h1 * __h1);
+#ifdef __STDC_IEC_559__
+	      // fixup for Annex F requirements
+	      _V __fixup = __hi; // __lo == 0
+	      // where(__lo == 0, __fixup)                   = __hi;
+	      where(isunordered(__x, __y + __z), __fixup) =
+		_Limits::quiet_NaN();
+	      where(isinf(__absx) || isinf(__absy) || isinf(__absz), __fixup) =
+		__inf;
+	      where(!(__lo == 0 || isunordered(__x, __y + __z) ||
+		      isinf(__absx) || isinf(__absy) || isinf(__absz)),
+		    __fixup) = __r;
+	      __r            = __fixup;
+#endif
+	      return __r;
+	    }
+	}
+    }
+}
+
+template <typename _Tp, typename _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> hypot(const simd<_Tp, _Abi>& __x,
+					      const simd<_Tp, _Abi>& __y,
+					      const simd<_Tp, _Abi>& __z)
+{
+  return __hypot<conditional_t<__is_fixed_size_abi_v<_Abi>,
+			       const simd<_Tp, _Abi>&, simd<_Tp, _Abi>>>(
+    __x, __y, __z);
+}
+_GLIBCXX_SIMD_CVTING3(hypot)
+
+// pow {{{
+/*
+ * algorithm for pow:
+ *
+ * pow(x, y) = ±2^(y * log2|x|)
+ * The relative error of the result is ln2 times the absolute error of
+ * y * log2|x|, and |y * log2|x|| reaches 1075 for finite double results.
+ * Therefore float evaluates log2 and exp2 in double, and double calculates
+ * log2|x| and the product with y as unevaluated sums `hi + lo`
+ * (__log2_hi_lo, __two_prod, __exp2_hi_lo).
+ *
+ * If all elements of y are equal (the common `pow(v, 2)` case), integral
+ * exponents use repeated squaring and 0.5 uses sqrt.
+ */
+namespace __math_double
+{
+inline constexpr double __log2e_lo   = 0x1.777d0ffda0d24p-56; // 1/ln(2) - __log2e
+inline constexpr double __2_over_3    = 0x1.5555555555555p-1;  // 2/3
+inline constexpr double __2_over_3_lo = 0x1.5555555555555p-55; // 2/3 - __2_over_3
+}
+
+// __two_prod {{{
+/**\internal
+ * Returns `__a * __b` as `_M_hi + _M_lo` without loss of precision (Dekker).
+ */
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC __hi_lo<double, _Abi>
+			__two_prod(const simd<double, _Abi>& __a,
+				   const simd<double, _Abi>& __b)
+{
+  using _V        = simd<double, _Abi>;
+  const _V __a_hi = __zero_low_bits<27>(__a);
+  const _V __a_lo = __a - __a_hi;
+  const _V __b_hi = __zero_low_bits<27>(__b);
+  const _V __b_lo = __b - __b_hi;
+  __hi_lo<double, _Abi> __r;
+  __r._M_hi = __a * __b;
+  __r._M_lo = (((__a_hi * __b_hi - __r._M_hi) + __a_hi * __b_lo)
+	       + __a_lo * __b_hi)
+	      + __a_lo * __b_lo;
+  return __r;
+}
+
+// }}}
+// __log2_hi_lo {{{
+/**\internal
+ * Returns log2(\p __x) as `_M_hi + _M_lo` with a relative error below 2^-62
+ * for positive, finite \p __x.
+ *
+ * With s = m / (2 + m), log(1 + m) = 2 atanh(s) = 2s + 2s³/3 + 2s⁵/5 + ...
+ * |s| < 0.172, thus 2s and 2s³/3 are calculated as `hi + lo` (with
+ * s = __s_hi + __s_lo, where __s_hi has 26 significant bits) and the
+ * remaining terms contribute less than 2^-12 to the result.
+ */
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC __hi_lo<double, _Abi>
+			__log2_hi_lo(const simd<double, _Abi>& __x)
+{
+  using _V = simd<double, _Abi>;
+  using namespace __math_double;
+  const auto __split = __split_mantissa(__x);
+  const _V   __m     = __split._M_m; // in [√½ - 1, √2 - 1)
+  // 2 + __m == __d_hi + __d_lo exactly
+  const _V __d_hi = __zero_low_bits<27>(2 + __m);
+  const _V __d_lo = __m - (__d_hi - 2);
+  const _V __d_inv = 1 / (2 + __m);
+  const _V __s_hi  = __zero_low_bits<27>(__m * __d_inv);
+  // __s_hi * __d_hi is exact and close to __m
+  const _V __s_lo = ((__m - __s_hi * __d_hi) - __s_hi * __d_lo) * __d_inv;
+  const _V __s    = __s_hi + __s_lo;
+  const _V __s2   = __s * __s;
+  // 2s³/3 = __c._M_hi + __c._M_lo, __s_hi² is exact
+  const _V __s_hi2 = __s_hi * __s_hi;
+  const auto __s3  = __two_prod(__s_hi2, __s_hi);
+  auto       __c   = __two_prod(__s3._M_hi, _V(__2_over_3));
+  __c._M_lo += __s3._M_hi * __2_over_3_lo
+	       + (__s3._M_lo + 3 * __s_hi * __s_lo * __s) * __2_over_3;
+  _V __t;
+  __t = 0x1.2f684bda12f68p-4;              // 2/27
+  __t = __t * __s2 + 0x1.47ae147ae147bp-4; // 2/25
+  __t = __t * __s2 + 0x1.642c8590b2164p-4; // 2/23
+  __t = __t * __s2 + 0x1.8618618618618p-4; // 2/21
+  __t = __t * __s2 + 0x1.af286bca1af28p-4; // 2/19
+  __t = __t * __s2 + 0x1.e1e1e1e1e1e1ep-4; // 2/17
+  __t = __t * __s2 + 0x1.1111111111111p-3; // 2/15
+  __t = __t * __s2 + 0x1.3b13b13b13b14p-3; // 2/13
+  __t = __t * __s2 + 0x1.745d1745d1746p-3; // 2/11
+  __t = __t * __s2 + 0x1.c71c71c71c71cp-3; // 2/9
+  __t = __t * __s2 + 0x1.2492492492492p-2; // 2/7
+  __t = __t * __s2 + 0x1.999999999999ap-2; // 2/5
+  // log(1 + m) = __l_hi + __l_lo, |2 __s_hi| > |__c._M_hi|
+  const _V __l_hi = 2 * __s_hi + __c._M_hi;
+  const _V __l_lo = ((2 * __s_hi - __l_hi) + __c._M_hi)
+		    + (2 * __s_lo + (__c._M_lo + __t * (__s2 * __s2 * __s)));
+  // * log2(e)
+  auto __p = __two_prod(__l_hi, _V(__log2e));
+  __p._M_lo += __l_hi * __log2e_lo + __l_lo * __log2e;
+  // + e, |e| > |__p._M_hi| unless e = 0
+  const _V __q_hi = __split._M_e + __p._M_hi;
+  const _V __q_lo = ((__split._M_e - __q_hi) + __p._M_hi) + __p._M_lo;
+  // renormalize such that |_M_lo| <= ½ulp(_M_hi)
+  __hi_lo<double, _Abi> __r;
+  __r._M_hi = __q_hi + __q_lo;
+  __r._M_lo = (__q_hi - __r._M_hi) + __q_lo;
+  return __r;
+}
+
+// }}}
+// __exp2_hi_lo {{{
+/**\internal
+ * Returns 2^(\p __hi + \p __lo) for |__lo| <= ulp(__hi). Over- and underflow
+ * follow the current rounding mode, as for exp2.
+ */
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<double, _Abi>
+  __exp2_hi_lo(const simd<double, _Abi>& __hi, const simd<double, _Abi>& __lo)
+{
+  using _V      = simd<double, _Abi>;
+  using _Limits = std::numeric_limits<double>;
+  using namespace __math_double;
+  constexpr double __fast_limit = _Limits::max_exponent - 2;
+  if (_GLIBCXX_SIMD_IS_LIKELY(all_of(abs(__hi) < __fast_limit)))
+    {
+      const _V __n = round(__hi);
+      // __hi - __n is exact
+      return (1 + __expm1Series(((__hi - __n) + __lo) * __ln2))
+	     * __make_pow2(__n);
+    }
+  else
+    {
+      // see exp for the choice of the clamping range
+      constexpr double __max_arg = _Limits::max_exponent + 1;
+      constexpr double __min_arg = _Limits::min_exponent - _Limits::digits - 2;
+      const _V __hic = clamp(__hi, _V(__min_arg), _V(__max_arg));
+      const _V __n   = round(__hic);
+      // __lo is irrelevant (or NaN) if __hi was clamped
+      _V __f = __hic - __n;
+      where(__hic == __hi, __f) += __lo;
+      return __scale_by_pow2(1 + __expm1Series(__f * __ln2), __n);
+    }
+}
+
+// }}}
+// __pow_for_float {{{
+/**\internal
+ * Returns 2^(\p __y * log2(\p __x)) for positive, finite \p __x and finite
+ * \p __y, with an error far below float precision, as long as the result
+ * fits into float. A short series in double suffices and the conversion to
+ * float takes care of overflow and subnormal results.
+ */
+template <class _Abi>
+simd<double, _Abi> __pow_for_float(const simd<double, _Abi>& __x,
+				   const simd<double, _Abi>& __y)
+{
+  using _V = simd<double, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    {
+      return __fixed_size_apply<_V>(
+	[](auto __a, auto __b) { return __pow_for_float(__a, __b); }, __x, __y);
+    }
+  else
+    {
+      using namespace __math_double;
+      using _Limits      = std::numeric_limits<float>;
+      const auto __split = __split_mantissa(__x);
+      const _V   __s     = __split._M_m / (2 + __split._M_m);
+      const _V   __s2    = __s * __s;
+      _V         __l;
+      __l = 0x1.3b13b13b13b14p-3;              // 2/13
+      __l = __l * __s2 + 0x1.745d1745d1746p-3; // 2/11
+      __l = __l * __s2 + 0x1.c71c71c71c71cp-3; // 2/9
+      __l = __l * __s2 + 0x1.2492492492492p-2; // 2/7
+      __l = __l * __s2 + 0x1.999999999999ap-2; // 2/5
+      __l = __l * __s2 + 0x1.5555555555555p-1; // 2/3
+      __l = __l * (__s2 * __s) + 2 * __s;      // log(1 + m)
+      const _V __t = clamp(__y * (__split._M_e + __l * __log2e),
+			   _V(_Limits::min_exponent - _Limits::digits - 2),
+			   _V(_Limits::max_exponent + 1));
+      const _V __n = round(__t);
+      return (1 + __expm1Series((__t - __n) * __ln2)) * __make_pow2(__n);
+    }
+}
+
+// }}}
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  pow(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__pow(__data(__x), __data(__y))};
+    }
+  else
+    {
+      using _Limits = std::numeric_limits<_Tp>;
+      const _Tp __y0 = __y[0];
+      if (all_of(__y == __y0))
+	{
+	  if (__y0 == _Tp(.5))
+	    {
+	      // sqrt(-0) = -0 and sqrt(-inf) = NaN, but pow returns +0 and +inf
+	      _V __r = sqrt(__x);
+	      where(__x == -_Limits::infinity(), __r) = _Limits::infinity();
+	      return abs(__r);
+	    }
+	  // other exponents accumulate more than 2 ulp of error
+	  if (__y0 == std::trunc(__y0) && __y0 >= -2 && __y0 <= 4)
+	    {
+	      const int __n = int(__y0);
+	      _V        __b = __x;
+	      _V        __r = 1;
+	      for (unsigned __k = std::abs(__n); __k; __k >>= 1)
+		{
+		  if (__k & 1)
+		    __r *= __b;
+		  if (__k > 1)
+		    __b *= __b;
+		}
+	      if (__n >= 0)
+		return __r;
+	      // 1/x^-n is inaccurate if x^-n is subnormal or overflowed
+	      const _V __ar = abs(__r);
+	      const _V __ax = abs(__x);
+	      if (_GLIBCXX_SIMD_IS_LIKELY(
+		    none_of((__ar < _Limits::min() || __ar > _Limits::max())
+			    && __ax > 0 && __ax < _Limits::infinity())))
+		return 1 / __r;
+	    }
+	}
+
+      const _V __ax = abs(__x);
+      _V       __r;
+      if constexpr (is_same_v<_Tp, float>)
+	{
+	  using _VD = rebind_simd_t<double, _V>;
+	  __r       = static_simd_cast<_V>(__pow_for_float(
+	    static_simd_cast<_VD>(__ax), static_simd_cast<_VD>(__y)));
+	}
+      else
+	{
+	  const auto __l = __log2_hi_lo(__ax);
+	  const auto __t = __two_prod(__y, __l._M_hi);
+	  __r = __exp2_hi_lo(__t._M_hi, __t._M_lo + __y * __l._M_lo);
+	}
+
+      // special cases (Annex F):
+      // y * log2|x| is NaN for x = ±0 or ±inf with y = 0, for x = ±1 with
+      // y = ±inf, and its low part is NaN whenever the high part is infinite.
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(
+	    !all_of(__x > 0 && __x < _Limits::infinity()
+		    && abs(__y) < _Limits::infinity())))
+	{
+	  constexpr _Tp __inf = _Limits::infinity();
+	  const auto __y_int = __y == trunc(__y); // including ±inf
+	  const auto __y_odd = __y_int && trunc(__y * _Tp(.5)) * 2 != __y;
+	  where(isinf(__y), __r) = 0;
+	  where(isinf(__y) && ((__ax > 1 && __y > 0) || (__ax < 1 && __y < 0)),
+		__r) = __inf;
+	  where((__ax == 0 && __y > 0) || (__ax == __inf && __y < 0), __r) = 0;
+	  where((__ax == 0 && __y < 0) || (__ax == __inf && __y > 0), __r)
+	    = __inf;
+	  where(signbit(__x) && __y_odd, __r) = -__r;
+	  where((__x < 0 && __x > -__inf && !__y_int) || isnan(__x) || isnan(__y),
+		__r) = _Limits::quiet_NaN();
+	  where(__x == -1 && isinf(__y), __r) = 1;
+	  where(__x == 1 || __y == 0, __r)    = 1;
+	}
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    pow(simd<_Tp, simd_abi::scalar> __x, simd<_Tp, simd_abi::scalar> __y)
+{
+    return std::pow(__data(__x), __data(__y));
+}
+_GLIBCXX_SIMD_CVTING2(pow)
+
+// }}}
+
+_GLIBCXX_SIMD_MATH_CALL_(sqrt)
+// error functions {{{
+/*
+ * algorithm for erf and erfc (fdlibm):
+ *
+ * With a = |x|:
+ * [0, 0.84375):  erf(a) = a + a * P(a²) / Q(a²)
+ *                erfc(x) = 1 - erf(x), or ½ - (x - ½ + x * P/Q) for x >= ¼
+ * [0.84375, 1.25): with s = a - 1
+ *                erf(a) = erx + P(s) / Q(s), erx = erf(1) to float precision
+ *                erfc(a) = (1 - erx) - P(s) / Q(s) (1 - erx is exact)
+ * [1.25, ∞):     erfc(a) = exp(-a² - 0.5625 + R(1/a²) / S(1/a²)) / a
+ *                erf(a) = 1 - erfc(a)
+ *                erfc(-a) = 2 - erfc(a)
+ * R/S uses a second set of coefficients for a >= 1/0.35. -a² is calculated
+ * as -z² + (z - a)(z + a), with z = a truncated to less than half the digits,
+ * such that -z² - 0.5625 is exact. The exponent is reduced by n ln2 without
+ * rounding the sum, thus a single exp series suffices. The arguments are
+ * clamped to 6 (erf) and 11 or 28 (erfc, float or double), where the result
+ * has already rounded to ±1, 0, or 2.
+ *
+ * The same coefficients (rounded to float) serve float. Each interval is only
+ * evaluated if any element needs it.
+ */
+namespace __math_double
+{
+inline constexpr double __erx = 8.45062911510467529297e-01; // erf(1), 24 bits
+}
+// __erfSeries {{{
+/**\internal
+ * Approximates erf(x)/x - 1 for |x| < 0.84375, with \p __z = x².
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __erfSeries(const simd<_Tp, _Abi>& __z)
+{
+  simd<_Tp, _Abi> __p, __q;
+  __p = _Tp(-2.37630166566501626084e-05);
+  __p = __p * __z + _Tp(-5.77027029648944159157e-03);
+  __p = __p * __z + _Tp(-2.84817495755985104766e-02);
+  __p = __p * __z + _Tp(-3.25042107247001499370e-01);
+  __p = __p * __z + _Tp(1.28379167095512558561e-01);
+  __q = _Tp(-3.96022827877536812320e-06);
+  __q = __q * __z + _Tp(1.32494738004321644526e-04);
+  __q = __q * __z + _Tp(5.08130628187576562776e-03);
+  __q = __q * __z + _Tp(6.50222499887672944485e-02);
+  __q = __q * __z + _Tp(3.97917223959155352819e-01);
+  __q = __q * __z + 1;
+  return __p / __q;
+}
+
+// }}}
+// __erfOneSeries {{{
+/**\internal
+ * Approximates erf(1 + s) - erx for s in [-0.15625, 0.25).
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __erfOneSeries(const simd<_Tp, _Abi>& __s)
+{
+  simd<_Tp, _Abi> __p, __q;
+  __p = _Tp(-2.16637559486879084300e-03);
+  __p = __p * __s + _Tp(3.54783043256182359371e-02);
+  __p = __p * __s + _Tp(-1.10894694282396677476e-01);
+  __p = __p * __s + _Tp(3.18346619901161753674e-01);
+  __p = __p * __s + _Tp(-3.72207876035701323847e-01);
+  __p = __p * __s + _Tp(4.14856118683748331666e-01);
+  __p = __p * __s + _Tp(-2.36211856075265944077e-03);
+  __q = _Tp(1.19844998467991074170e-02);
+  __q = __q * __s + _Tp(1.36370839120290507362e-02);
+  __q = __q * __s + _Tp(1.26171219808761642112e-01);
+  __q = __q * __s + _Tp(7.18286544141962662868e-02);
+  __q = __q * __s + _Tp(5.40397917702171048937e-01);
+  __q = __q * __s + _Tp(1.06420880400844228286e-01);
+  __q = __q * __s + 1;
+  return __p / __q;
+}
+
+// }}}
+// __erfc_tail {{{
+/**\internal
+ * Returns erfc(\p __a) for __a >= 1.25 (and NaN excluded).
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __erfc_tail(const simd<_Tp, _Abi>& __a)
+{
+  using _V           = simd<_Tp, _Abi>;
+  const _V   __s     = 1 / (__a * __a);
+  const auto __near  = __a < _Tp(1 / 0.35);
+  _V         __r, __q;
+  if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__near)))
+    {
+      __r = _Tp(-9.81432934416914548592e+00);
+      __r = __r * __s + _Tp(-8.12874355063065934246e+01);
+      __r = __r * __s + _Tp(-1.84605092906711035994e+02);
+      __r = __r * __s + _Tp(-1.62396669462573470355e+02);
+      __r = __r * __s + _Tp(-6.23753324503260060396e+01);
+      __r = __r * __s + _Tp(-1.05586262253232909814e+01);
+      __r = __r * __s + _Tp(-6.93858572707181764372e-01);
+      __r = __r * __s + _Tp(-9.86494403484714822705e-03);
+      __q = _Tp(-6.04244152148580987438e-02);
+      __q = __q * __s + _Tp(6.57024977031928170135e+00);
+      __q = __q * __s + _Tp(1.08635005541779435134e+02);
+      __q = __q * __s + _Tp(4.29008140027567833386e+02);
+      __q = __q * __s + _Tp(6.45387271733267880336e+02);
+      __q = __q * __s + _Tp(4.34565877475229228821e+02);
+      __q = __q * __s + _Tp(1.37657754143519042600e+02);
+      __q = __q * __s + _Tp(1.96512716674392571292e+01);
+      __q = __q * __s + 1;
+    }
+  if (!all_of(__near))
+    {
+      _V __rb, __qb;
+      __rb = _Tp(-4.83519191608651397019e+02);
+      __rb = __rb * __s + _Tp(-1.02509513161107724954e+03);
+      __rb = __rb * __s + _Tp(-6.37566443368389627722e+02);
+      __rb = __rb * __s + _Tp(-1.60636384855821916062e+02);
+      __rb = __rb * __s + _Tp(-1.77579549177547519889e+01);
+      __rb = __rb * __s + _Tp(-7.99283237680523006574e-01);
+      __rb = __rb * __s + _Tp(-9.86494292470009928597e-03);
+      __qb = _Tp(-2.24409524465858183362e+01);
+      __qb = __qb * __s + _Tp(4.74528541206955367215e+02);
+      __qb = __qb * __s + _Tp(2.55305040643316442583e+03);
+      __qb = __qb * __s + _Tp(3.19985821950859553908e+03);
+      __qb = __qb * __s + _Tp(1.53672958608443695994e+03);
+      __qb = __qb * __s + _Tp(3.25792512996573918826e+02);
+      __qb = __qb * __s + _Tp(3.03380607434824582924e+01);
+      __qb = __qb * __s + 1;
+      where(!__near, __r) = __rb;
+      where(!__near, __q) = __qb;
+    }
+  constexpr _Tp __ln2_hi =
+    sizeof(_Tp) == 4 ? __math_float::__ln2_hi : __math_double::__ln2_hi;
+  constexpr _Tp __ln2_lo =
+    sizeof(_Tp) == 4 ? __math_float::__ln2_lo : __math_double::__ln2_lo;
+  // z has 11 (float) or 21 (double) significant bits, thus __hi is exact for
+  // __a <= 28 and __n stays in the range of __scale_by_pow2 for float __a <= 11
+  const _V __z  = __zero_low_bits<sizeof(_Tp) == 4 ? 13 : 32>(__a);
+  const _V __hi = -__z * __z - _Tp(0.5625);
+  const _V __lo = (__z - __a) * (__z + __a) + __r / __q;
+  // fold __hi + __lo without rounding the sum; __hi - __n * __ln2_hi is exact
+  const _V __n = __fold_ln2(__hi + __lo)._M_n;
+  const _V __f = ((__hi - __n * __ln2_hi) + __lo) - __n * __ln2_lo;
+  // divide before scaling, such that subnormal results are rounded once
+  return __scale_by_pow2((1 + __expm1Series(__f)) / __a, __n);
+}
+
+// }}}
+// erf {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  erf(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__erf(__data(__x))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      const _V   __a     = abs(__x);
+      const auto __small = __a < _Tp(0.84375);
+      const auto __large = !(__a < _Tp(1.25)); // includes NaN
+      _V         __r;
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+	{
+	  // scaled by 8 to keep full precision for subnormal results
+	  const _V __a8 = __a * 8;
+	  __r           = (__a8 + __a8 * __erfSeries(__a * __a)) * _Tp(.125);
+	}
+      if (any_of(!__small && !__large))
+	where(!__small, __r) = _Tp(__math_double::__erx) + __erfOneSeries(__a - 1);
+      if (any_of(__large))
+	{
+	  where(__large, __r) = 1 - __erfc_tail(min(__a, _V(6)));
+	  // exact in the directed rounding modes, too
+	  where(__a == std::numeric_limits<_Tp>::infinity(), __r) = 1;
+	  where(isnan(__x), __r) = __x;
+	}
+      return __r | (__x & _V(_Tp(-0.)));
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    erf(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::erf(__data(__x));
+}
+
+// }}}
+// erfc {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  erfc(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__erfc(__data(__x))};
+    }
+  else
+    {
+      constexpr _Tp __erx = __math_double::__erx;
+      const _V      __a   = abs(__x);
+      const auto __small  = __a < _Tp(0.84375);
+      const auto __large  = !(__a < _Tp(1.25)); // includes NaN
+      _V         __r;
+      if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+	{
+	  const _V __xy = __x * __erfSeries(__x * __x);
+	  __r           = 1 - (__x + __xy);
+	  where(__x >= _Tp(.25), __r) = _Tp(.5) - ((__x - _Tp(.5)) + __xy);
+	}
+      if (any_of(!__small && !__large))
+	{
+	  const _V __t = __erfOneSeries(__a - 1);
+	  where(!__small, __r) = (1 - __erx) - __t;
+	  where(!__small && __x < 0, __r) = 1 + (__erx + __t);
+	}
+      if (any_of(__large))
+	{
+	  // erfc underflows to 0 beyond 10.1 (float) and 27.3 (double)
+	  constexpr _Tp __max_arg = sizeof(_Tp) == 4 ? 11 : 28;
+	  const _V      __t = __erfc_tail(min(__a, _V(__max_arg)));
+	  where(__large, __r) = __t;
+	  where(__large && __x < 0, __r) = 2 - __t;
+	  // exact in the directed rounding modes, too
+	  where(__x == std::numeric_limits<_Tp>::infinity(), __r) = 0;
+	  where(__x == -std::numeric_limits<_Tp>::infinity(), __r) = 2;
+	  where(isnan(__x), __r) = __x;
+	}
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    erfc(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::erfc(__data(__x));
+}
+
+// }}}
+// }}}
+// gamma functions {{{
+/*
+ * algorithm for lgamma and tgamma:
+ *
+ * float is calculated in double, with an error far below float precision.
+ *
+ * For |x| < 13 the argument is shifted into [1.25, 2.5] via the recurrence
+ * Γ(x + 1) = x Γ(x):
+ * Γ(x) = (x - 1) (x - 2) ... (x - m + 2) Γ(2 + t)   for m >= 2
+ * Γ(x) = Γ(2 + t) / (x (x + 1) ... (x + 1 - m))     for m <= 1
+ * with the integer m ≈ x and t = x - m in [-0.75, 0.5]. The product is
+ * accumulated as `hi + lo`, which keeps it accurate close to the poles.
+ * lgamma(2 + t) is approximated by __lgamma2, a polynomial without
+ * cancellation near the zero at t = 0.
+ *
+ * For x >= 13 Stirling's series applies:
+ * lgamma(x) = (x - ½)(log(x) - 1) + log(√(2π)) - ½ + s(x)
+ * where s(x) = Σ B_2k / (2k (2k - 1) x^(2k - 1)). tgamma evaluates the same
+ * sum in log2 and extended precision (see pow) and returns 2^n e^r.
+ *
+ * For x <= -13 the reflection formula applies:
+ * Γ(x) = -π / (x sin(πx) Γ(-x))
+ *
+ * lgamma has two zeros in each of the intervals (-3, -2), ..., (-13, -12).
+ * Close to them the double result has a small absolute but a large relative
+ * error, which would require a tabulated expansion around each zero.
+ */
+// __lgamma2 {{{
+/**\internal
+ * Approximates lgamma(2 + t) for t in [-0.75, 0.5] (Chebyshev interpolation,
+ * converted to monomials).
+ */
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<double, _Abi>
+  __lgamma2(const simd<double, _Abi>& __t)
+{
+  simd<double, _Abi> __p;
+  __p = 0x1.1ea9933c9faafp-23;
+  __p = __p * __t + 0x1.daa8647ef72a1p-23;
+  __p = __p * __t + 0x1.16d5db340cdbp-23;
+  __p = __p * __t - 0x1.381e2d408eb64p-22;
+  __p = __p * __t + 0x1.94dea87554a87p-25;
+  __p = __p * __t - 0x1.bb564241362dap-22;
+  __p = __p * __t + 0x1.167374fb7defep-20;
+  __p = __p * __t - 0x1.10776074d77d8p-19;
+  __p = __p * __t + 0x1.2441945797e4ap-18;
+  __p = __p * __t - 0x1.3cea4dcd1fb68p-17;
+  __p = __p * __t + 0x1.58192338840a9p-16;
+  __p = __p * __t - 0x1.78dc2fc0ecbfdp-15;
+  __p = __p * __t + 0x1.a1277cbd0521dp-14;
+  __p = __p * __t - 0x1.d3fd59ec8d15fp-13;
+  __p = __p * __t + 0x1.0b36afc02d66fp-11;
+  __p = __p * __t - 0x1.38ac5c15eef68p-10;
+  __p = __p * __t + 0x1.7add6ead92a86p-9;
+  __p = __p * __t - 0x1.e404fc21b267bp-8;
+  __p = __p * __t + 0x1.51322ac7d8361p-6;  // ≈ -(ζ(4) - 1)/4
+  __p = __p * __t - 0x1.13e001a5575b2p-4;  // ≈ -(ζ(3) - 1)/3
+  __p = __p * __t + 0x1.4a34cc4a60fa6p-2;  // ≈ (ζ(2) - 1)/2
+  __p = __p * __t + 0x1.b0ee6072093cep-2;  // ≈ 1 - γ
+  return __p * __t;
+}
+
+// }}}
+// __gamma_reduce {{{
+/**\internal
+ * Splits \p __x in (-13, 13) into `Γ(x) = Γ(2 + _M_t) * (_M_f + _M_f_lo)^±1`,
+ * with the exponent +1 where `_M_up` is true (m >= 2) and -1 otherwise. See
+ * above.
+ */
+template <class _Abi>
+struct __gamma_reduced
+{
+  simd<double, _Abi>                     _M_t;
+  simd<double, _Abi>                     _M_f;
+  simd<double, _Abi>                     _M_f_lo;
+  typename simd<double, _Abi>::mask_type _M_up;
+};
+
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC __gamma_reduced<_Abi>
+			__gamma_reduce(const simd<double, _Abi>& __x)
+{
+  using _V = simd<double, _Abi>;
+  _V __m   = round(__x);
+  where(__x >= 1.25 && __m < 2, __m) = 2;
+  where(__x >= .25 && __m < 1, __m)  = 1;
+  __gamma_reduced<_Abi> __r = {__x - __m, 1, 0, __m >= 2};
+  // number of remaining factors x - k (m >= 2) or x + k (m <= 1)
+  _V __n    = 1 - __m;
+  _V __step = 1;
+  where(__r._M_up, __n)    = __m - 2;
+  where(__r._M_up, __step) = -1;
+  // starting with x (instead of 1 * (x + 0)) keeps the sign of -0
+  where(!__r._M_up, __r._M_f) = __x;
+  for (int __k = 1; any_of(__n >= __k); ++__k)
+    {
+      const auto __active = __n >= __k;
+      const _V   __y      = __x + __step * __k;
+      const auto __p      = __two_prod(__r._M_f, __y);
+      where(__active, __r._M_f_lo) = __r._M_f_lo * __y + __p._M_lo;
+      where(__active, __r._M_f)    = __p._M_hi;
+    }
+  return __r;
+}
+
+// }}}
+// __sin_pi {{{
+/**\internal
+ * Returns sin(π\p __x). The argument reduction is exact.
+ */
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<double, _Abi>
+  __sin_pi(const simd<double, _Abi>& __x)
+{
+  using _V = simd<double, _Abi>;
+  // in [-1, 1]
+  _V __r = __x - 2 * round(__x * .5);
+  // sin(π r) = sin(π (±1 - r))
+  where(__r > .5, __r)  = 1 - __r;
+  where(__r < -.5, __r) = -1 - __r;
+  return sin(__r * __math_double::__pi);
+}
+
+// }}}
+// __stirling_series {{{
+/**\internal
+ * Returns s(\p __x) = lgamma(x) - ((x - ½)(log(x) - 1) + log(√(2π)) - ½) for
+ * x >= 13.
+ */
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<double, _Abi>
+  __stirling_series(const simd<double, _Abi>& __x)
+{
+  const simd<double, _Abi> __y  = 1 / __x;
+  const simd<double, _Abi> __y2 = __y * __y;
+  simd<double, _Abi>       __s;
+  __s = 1. / 156;
+  __s = __s * __y2 - 691. / 360360;
+  __s = __s * __y2 + 1. / 1188;
+  __s = __s * __y2 - 1. / 1680;
+  __s = __s * __y2 + 1. / 1260;
+  __s = __s * __y2 - 1. / 360;
+  __s = __s * __y2 + 1. / 12;
+  return __s * __y;
+}
+
+// }}}
+// __fold_tgamma_stirling {{{
+/**\internal
+ * Returns Γ(\p __x) = 2^_M_n e^_M_r for x in [13, 200], with
+ * log2(Γ(x)) = (x - ½)(log2(x) - log2(e)) + log2(√(2π)) - ½log2(e)
+ *              + s(x) log2(e)
+ * summed up in extended precision. Multiplying the result by e.g. 2^k cannot
+ * overflow prematurely.
+ */
+template <class _Abi>
+_GLIBCXX_SIMD_INTRINSIC __ln2_folded<double, _Abi>
+			__fold_tgamma_stirling(const simd<double, _Abi>& __x)
+{
+  using _V = simd<double, _Abi>;
+  using namespace __math_double;
+  // log2(√(2π)) - ½log2(e)
+  constexpr double __c    = 0x1.3573fcf6d5af9p-1;
+  constexpr double __c_lo = 0x1.0e57879459ce1p-55;
+  const auto __l = __log2_hi_lo(__x);
+  // log2(x) - log2(e) = __u + __u_lo with |log2(x)| > log2(e)
+  const _V __u    = __l._M_hi - __log2e;
+  const _V __u_lo = ((__l._M_hi - __u) - __log2e) + (__l._M_lo - __log2e_lo);
+  // __x - .5 is exact
+  const auto __p = __two_prod(__x - .5, __u);
+  __ln2_folded<double, _Abi> __r;
+  // Using __p._M_hi in round (not only in sums) also keeps the compiler from
+  // contracting its multiplication into an FMA, which would break __p.
+  const _V __n = round(__p._M_hi);
+  // in [-½, 1.1]
+  const _V __f = (__p._M_hi - __n)
+		 + (__c + (((__x - .5) * __u_lo + __p._M_lo)
+			   + (__c_lo + __stirling_series(__x) * __log2e)));
+  const _V __n2 = round(__f);
+  __r._M_n      = __n + __n2;
+  __r._M_r      = (__f - __n2) * __ln2;
+  return __r;
+}
+
+// }}}
+// __lgamma_for_double {{{
+template <class _Abi>
+simd<double, _Abi> __lgamma_for_double(const simd<double, _Abi>& __x)
+{
+  using _V      = simd<double, _Abi>;
+  using _Limits = std::numeric_limits<double>;
+  constexpr double __log_sqrt_2pi_m_half = 0x1.acfe390c97d69p-2;
+  constexpr double __log_pi              = 0x1.250d048e7a1bdp+0;
+  const _V   __a     = abs(__x);
+  const auto __small = __a < 13;
+  _V         __r;
+  if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+    {
+      _V __xs = __x;
+      where(!__small, __xs) = 2;
+      const auto __g = __gamma_reduce(__xs);
+      // __d = f_lo / f, avoiding 0/0 at the poles
+      _V __d = 0;
+      where(__g._M_f_lo != 0, __d) = __g._M_f_lo / __g._M_f;
+      const _V __l = log(abs(__g._M_f)) + __d;
+      __r = __lgamma2(__g._M_t);
+      where(__g._M_up, __r) += __l;
+      where(!__g._M_up, __r) -= __l;
+      // 0 - 0 is -0 when rounding down
+      where(__x == 1 || __x == 2, __r) = 0;
+      // x (x + 1) is inexact for subnormal x in the directed rounding modes
+      where(__a < 0x1p-54, __r) = -log(__a);
+    }
+  if (!all_of(__small))
+    {
+      _V __l = (__a - .5) * (log(__a) - 1)
+	       + (__log_sqrt_2pi_m_half + __stirling_series(__a));
+      // lgamma(x) = log(π) - log|x sin(πx)| - lgamma(-x)
+      where(__x < 0, __l) = __log_pi - log(abs(__x * __sin_pi(__x))) - __l;
+      where(!__small, __r) = __l;
+      // poles at non-positive integers, including -inf
+      where(__x <= -13 && __x == round(__x), __r) = _Limits::infinity();
+      where(isnan(__x), __r) = __x;
+    }
+  return __r;
+}
+
+// }}}
+// __tgamma_for_double {{{
+template <class _Abi>
+simd<double, _Abi> __tgamma_for_double(const simd<double, _Abi>& __x)
+{
+  using _V      = simd<double, _Abi>;
+  using _Limits = std::numeric_limits<double>;
+  const _V   __a     = abs(__x);
+  const auto __small = __a < 13;
+  _V         __r;
+  if (_GLIBCXX_SIMD_IS_LIKELY(any_of(__small)))
+    {
+      _V __xs = __x;
+      where(!__small, __xs) = 2;
+      const auto __g = __gamma_reduce(__xs);
+      const _V   __e = exp(__lgamma2(__g._M_t));
+      // e / (f + f_lo) = e / f * (1 - f_lo / f); f_lo = 0 at the poles and
+      // for subnormal f, where e / f is infinite
+      __r = __e / __g._M_f;
+      where(__g._M_f_lo != 0, __r) -= __r * (__g._M_f_lo / __g._M_f);
+      where(__g._M_up, __r) = __e * __g._M_f + __e * __g._M_f_lo;
+      // x (x + 1) is inexact for subnormal x in the directed rounding modes;
+      // Γ(x) = 1/x - γ + O(x) with γ/|1/x| below ½ ulp
+      where(__a < 0x1p-54, __r) = 1 / __x;
+    }
+  if (!all_of(__small))
+    {
+      // Γ(200) overflows, 1/Γ(200) underflows
+      const auto __f = __fold_tgamma_stirling(min(__a, _V(200)));
+      _V __g = __scale_by_pow2(1 + __expm1Series(__f._M_r), __f._M_n);
+      if (any_of(__x < 0))
+	{
+	  // Γ(x) = c / Γ(-x) with c = -π / (x sin(πx)) = ±(1 + m) 2^k, where
+	  // 2^k / Γ(-x) avoids premature underflow
+	  const _V   __c = -__math_double::__pi / (__x * __sin_pi(__x));
+	  const auto __k = __split_mantissa(abs(__c));
+	  _V __rg = __scale_by_pow2(
+	    (1 + __k._M_m) * (1 + __expm1Series(-__f._M_r)),
+	    __k._M_e - __f._M_n);
+	  where(__c < 0, __rg) = -__rg;
+	  where(__x < 0, __g)  = __rg;
+	}
+      where(!__small, __r) = __g;
+      // the overflow of Γ(200) is max when rounding down or towards zero
+      where(__x == _Limits::infinity(), __r) = __x;
+      where(isnan(__x), __r) = __x;
+    }
+  // poles at negative integers, including -inf
+  where(__x < 0 && __x == round(__x), __r) = _Limits::quiet_NaN();
+  return __r;
+}
+
+// }}}
+// lgamma {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  lgamma(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__lgamma(__data(__x))};
+    }
+  else if constexpr (is_same_v<_Tp, float>)
+    {
+      using _VD = rebind_simd_t<double, _V>;
+      return static_simd_cast<_V>(lgamma(static_simd_cast<_VD>(__x)));
+    }
+  else
+    return __lgamma_for_double(__x);
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    lgamma(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::lgamma(__data(__x));
+}
+
+// }}}
+// tgamma {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  tgamma(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__math_per_chunk<_Tp, _Abi>())
+    {
+      return {__private_init, _Abi::_SimdImpl::__tgamma(__data(__x))};
+    }
+  else if constexpr (is_same_v<_Tp, float>)
+    {
+      using _VD = rebind_simd_t<double, _V>;
+      return static_simd_cast<_V>(tgamma(static_simd_cast<_VD>(__x)));
+    }
+  else
+    return __tgamma_for_double(__x);
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    tgamma(simd<_Tp, simd_abi::scalar> __x)
+{
+    return std::tgamma(__data(__x));
+}
+
+// }}}
+// }}}
+_GLIBCXX_SIMD_MATH_CALL_(ceil)
+_GLIBCXX_SIMD_MATH_CALL_(floor)
+_GLIBCXX_SIMD_MATH_CALL_(nearbyint)
+_GLIBCXX_SIMD_MATH_CALL_(rint)
+_GLIBCXX_SIMD_MATH_CALL_(lrint)
+_GLIBCXX_SIMD_MATH_CALL_(llrint)
+
+_GLIBCXX_SIMD_MATH_CALL_(round)
+_GLIBCXX_SIMD_MATH_CALL_(lround)
+_GLIBCXX_SIMD_MATH_CALL_(llround)
+
+_GLIBCXX_SIMD_MATH_CALL_(trunc)
+
+// fmod, remainder, remquo {{{
+/*
+ * algorithm for fmod, remainder, and remquo:
+ *
+ * __fmod_positive reduces a modulo b without rounding. Each iteration
+ * subtracts q d, with d = b 2^s and integral q < 2^10 (float) or 2^24
+ * (double). s ≥ 0 is chosen from the exponents of a and b. Zeroing the low
+ * (digits+1)/2 mantissa bits of d splits it into d_hi + d_lo such that q d_hi
+ * and q d_lo are exact. a - q d_hi is exact (Sterbenz, or it lies on the grid
+ * of d below 2^digits ulp) and the remainder a - q d is representable,
+ * therefore subtracting q d_lo is exact, too. Because none of the products
+ * round, FMA contraction cannot change the result. q is truncated from a
+ * rounded-up a/d; if that yields one more than the integral part the
+ * remainder is negative and d is added back. |x| < 2^9 |y| (float) or
+ * 2^23 |y| (double) needs a single iteration; the worst case (double max
+ * modulo a subnormal) takes 88.
+ *
+ * remainder (remquo) first reduces |x| modulo 2|y| (8|y|) and then subtracts
+ * |y| (4|y|, 2|y|, and |y|) as in fdlibm. This also determines the three low
+ * bits of the quotient.
+ *
+ * These three evaluate a fixed_size object one chunk after the other even if
+ * it has several chunks (cf. __math_per_chunk): the algorithm consists mostly
+ * of masked assignments, and every where on a fixed_size object converts its
+ * std::bitset mask into vector masks. Interleaved, fmod and remainder are not
+ * faster (0.85-1.1x) and remquo is slower (0.75-0.9x) with AVX2 and AVX-512.
+ */
+// __fmod_positive {{{
+/**\internal
+ * Returns \p __a mod \p __b for positive, finite \p __a and positive,
+ * non-NaN \p __b. The result is exact.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __fmod_positive(simd<_Tp, _Abi> __a, const simd<_Tp, _Abi>& __b)
+{
+  using _V                 = simd<_Tp, _Abi>;
+  using _Limits            = std::numeric_limits<_Tp>;
+  constexpr int __lo_bits  = (_Limits::digits + 1) / 2;
+  constexpr int __q_bits   = _Limits::digits - __lo_bits;
+  constexpr _Tp __round_up = 1 + 2 * _Limits::epsilon();
+  const auto    __bs       = __split_mantissa(__b);
+  const _V      __b_m      = 1 + __bs._M_m;
+  for (auto __k = __a >= __b; any_of(__k); __k = __a >= __b)
+    {
+      _V __ak = __b; // keeps inactive lanes out of the subnormal path
+      where(__k, __ak) = __a;
+      // a / d < 2^(__q_bits - 2)
+      const _V __s =
+	max(_V(), __split_mantissa(__ak)._M_e - __bs._M_e - (__q_bits - 3));
+      const _V __d = __scale_by_pow2(__b_m, __bs._M_e + __s);
+      const _V __q = trunc(__a / __d * __round_up);
+      // q d may overflow for a close to max; halving a and d is exact there
+      const auto __huge = __a > _Limits::max() * _Tp(.5);
+      _V         __ah   = __a;
+      _V         __dh   = __d;
+      where(__huge, __ah) *= _Tp(.5);
+      where(__huge, __dh) *= _Tp(.5);
+      const _V __d_hi = __zero_low_bits<__lo_bits>(__dh);
+      _V       __r    = (__ah - __q * __d_hi) - __q * (__dh - __d_hi);
+      // a ∈ [d, 2d): a - d_hi might not be exact, but a - d is
+      where(__q == 1, __r) = __ah - __dh;
+      where(__r < 0, __r) += __dh;
+      where(__huge, __r) += __r;
+      where(__k, __a) = __r;
+    }
+  return __a;
+}
+
+// }}}
+// __remainder_tail {{{
+/**\internal
+ * Returns the IEEE remainder of \p __r modulo \p __b for \p __r in [0, 2b) and
+ * adds the number of subtracted \p __b to \p __quo.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __remainder_tail(simd<_Tp, _Abi> __r, const simd<_Tp, _Abi>& __b,
+		   simd<_Tp, _Abi>& __quo)
+{
+  // r + r cannot round; if it overflows the comparison is still correct
+  const auto __k1 = __r + __r > __b;
+  where(__k1, __r) -= __b;
+  where(__k1, __quo) += 1;
+  const auto __k2 = __k1 && __r + __r >= __b;
+  where(__k2, __r) -= __b;
+  where(__k2, __quo) += 1;
+  return __r;
+}
+
+// }}}
+// fmod {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  fmod(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_abi<_Abi, simd_abi::scalar>() ||
+		__is_fixed_size_abi_v<_Abi>)
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__fmod(__data(__x), __data(__y))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      using _Limits    = std::numeric_limits<_Tp>;
+      _V         __a   = abs(__x);
+      _V         __b   = abs(__y);
+      const auto __nan = !(__a < _Limits::infinity()) || !(__b > 0);
+      where(__nan, __a) = 0;
+      where(__nan, __b) = 1;
+      _V __r = __fmod_positive(__a, __b) | (__x & _V(_Tp(-0.)));
+      where(__nan, __r) = _Limits::quiet_NaN();
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    fmod(simd<_Tp, simd_abi::scalar> __x, simd<_Tp, simd_abi::scalar> __y)
+{
+    return std::fmod(__data(__x), __data(__y));
+}
+_GLIBCXX_SIMD_CVTING2(fmod)
+
+// }}}
+// remainder {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  remainder(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_abi<_Abi, simd_abi::scalar>() ||
+		__is_fixed_size_abi_v<_Abi>)
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__remainder(__data(__x), __data(__y))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      using _Limits    = std::numeric_limits<_Tp>;
+      _V         __a   = abs(__x);
+      _V         __b   = abs(__y);
+      const auto __nan = !(__a < _Limits::infinity()) || !(__b > 0);
+      where(__nan, __a) = 0;
+      where(__nan, __b) = 1;
+      // if 2|y| overflows, |x| < 2|y| holds already
+      _V __quo = 0;
+      _V __r   = __remainder_tail(__fmod_positive(__a, __b + __b), __b, __quo)
+	       ^ (__x & _V(_Tp(-0.)));
+      where(__nan, __r) = _Limits::quiet_NaN();
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    remainder(simd<_Tp, simd_abi::scalar> __x, simd<_Tp, simd_abi::scalar> __y)
+{
+    return std::remainder(__data(__x), __data(__y));
+}
+_GLIBCXX_SIMD_CVTING2(remainder)
+
+// }}}
+// remquo {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  remquo(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y,
+	 fixed_size_simd<int, simd_size_v<_Tp, _Abi>>* __z)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_abi<_Abi, simd_abi::scalar>() ||
+		__is_fixed_size_abi_v<_Abi>)
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__remquo(__data(__x), __data(__y),
+					&__data(*__z))};
+    }
+  else
+    {
+      using namespace std::experimental::__proposed::float_bitwise_operators;
+      using _Limits    = std::numeric_limits<_Tp>;
+      _V         __a   = abs(__x);
+      _V         __b   = abs(__y);
+      const auto __nan = !(__a < _Limits::infinity()) || !(__b > 0);
+      where(__nan, __a) = 0;
+      where(__nan, __b) = 1;
+      // if 8|y| (4|y|, 2|y|) overflows, |x| is smaller already
+      _V         __r   = __fmod_positive(__a, __b * 8);
+      _V         __quo = 0;
+      const auto __k4  = __r >= __b * 4;
+      where(__k4, __r) -= __b * 4;
+      where(__k4, __quo) += 4;
+      const auto __k2 = __r >= __b + __b;
+      where(__k2, __r) -= __b + __b;
+      where(__k2, __quo) += 2;
+      __r = __remainder_tail(__r, __b, __quo) ^ (__x & _V(_Tp(-0.)));
+      where(signbit(__x) != signbit(__y), __quo) = -__quo;
+      where(__nan, __r)   = _Limits::quiet_NaN();
+      where(__nan, __quo) = 0;
+      *__z = static_simd_cast<fixed_size_simd<int, _V::size()>>(__quo);
+      return __r;
+    }
+}
+
+template <class _Tp>
+_GLIBCXX_SIMD_ALWAYS_INLINE
+    enable_if_t<std::is_floating_point<_Tp>::value, simd<_Tp, simd_abi::scalar>>
+    remquo(simd<_Tp, simd_abi::scalar> __x, simd<_Tp, simd_abi::scalar> __y,
+	   fixed_size_simd<int, 1>* __z)
+{
+    int __tmp;
+    const _Tp __r = std::remquo(__data(__x), __data(__y), &__tmp);
+    *__z = __tmp;
+    return __r;
+}
+
+// }}}
+// }}}
+template <typename _Tp, typename _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  copysign(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+{
+  using namespace std::experimental::__proposed::float_bitwise_operators;
+  const auto __signmask = -simd<_Tp, _Abi>();
+  return (__x & (__x ^ __signmask)) | (__y & __signmask);
+}
+
+
+_GLIBCXX_SIMD_MATH_CALL2_(nextafter, _Tp)
+// not covered in [parallel.simd.math]:
+// _GLIBCXX_SIMD_MATH_CALL2_(nexttoward, long double)
+_GLIBCXX_SIMD_MATH_CALL2_(fdim, _Tp)
+_GLIBCXX_SIMD_MATH_CALL2_(fmax, _Tp)
+_GLIBCXX_SIMD_MATH_CALL2_(fmin, _Tp)
+
+// fma {{{
+/**\internal
+ * Returns \p __a + \p __b rounded to odd, i.e. truncated and with the last
+ * mantissa bit set if the sum is inexact. Rounding this to at least two bits
+ * less precision rounds \p __a + \p __b correctly. Requires rounding to
+ * nearest.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+			__add_round_to_odd(const simd<_Tp, _Abi>& __a,
+					   const simd<_Tp, _Abi>& __b)
+{
+  using namespace std::experimental::__proposed;
+  using _V  = simd<_Tp, _Abi>;
+  using _IV = rebind_simd_t<__int_for_sizeof_t<_Tp>, _V>;
+  // TwoSum: __s + __err == __a + __b
+  const _V __s   = __a + __b;
+  const _V __bb  = __s - __a;
+  const _V __err = (__a - (__s - __bb)) + (__b - __bb);
+  // Round to odd: truncate towards zero, i.e. step one ulp back if __err
+  // points towards zero, and set the last bit if inexact. The lane masks are
+  // computed as -1/0 integers from sign bits instead of simd_mask, which for
+  // fixed_size would be bitsets.
+  using _Ip             = typename _IV::value_type;
+  constexpr int __sign  = sizeof(_Tp) * 8 - 1;
+  constexpr _Ip __inf   = std::numeric_limits<_Ip>::max()
+			& ~((_Ip(1) << (std::numeric_limits<_Tp>::digits - 1)) - 1);
+  const _IV __err_bits  = simd_reinterpret_cast<_IV>(__err);
+  _IV       __bits      = simd_reinterpret_cast<_IV>(__s);
+  const _IV __abs_err   = __err_bits & std::numeric_limits<_Ip>::max();
+  // 0 < |__err| <= inf; an infinite __s yields a NaN __err
+  const _IV __inexact   = (-__abs_err & (__abs_err - (__inf + 1))) >> __sign;
+  const _IV __to_zero   = (__err_bits ^ __bits) >> __sign;
+  __bits = (__bits + (__to_zero & __inexact)) | (__inexact & 1);
+  return simd_reinterpret_cast<_V>(__bits);
+}
+
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  fma(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y,
+      const simd<_Tp, _Abi>& __z)
+{
+  using _V = simd<_Tp, _Abi>;
+#if _GLIBCXX_SIMD_X86INTRIN
+  if constexpr (__have_fma || __have_fma4 ||
+		__is_abi<_Abi, simd_abi::scalar>())
+    {} // the _SimdImpl maps directly to the instruction or std::fma
+  else if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_apply<_V>(
+      [](auto __a, auto __b, auto __c) { return fma(__a, __b, __c); }, __x,
+      __y, __z);
+  else if constexpr (is_same_v<_Tp, float>)
+    {
+      // the product of two floats is exact in double, which leaves two
+      // roundings of the sum: to double and then to float. That is harmless
+      // in the directed rounding modes, but to nearest the first rounding
+      // has to round to odd instead.
+      using _DV      = rebind_simd_t<double, _V>;
+      const _DV __xy = static_simd_cast<_DV>(__x) * static_simd_cast<_DV>(__y);
+      const _DV __zd = static_simd_cast<_DV>(__z);
+      if (_GLIBCXX_SIMD_IS_LIKELY(_MM_GET_ROUNDING_MODE() == _MM_ROUND_NEAREST))
+	return static_simd_cast<_V>(__add_round_to_odd(__xy, __zd));
+      else
+	return static_simd_cast<_V>(__xy + __zd);
+    }
+  else
+    {
+      // Dekker's product: __xy + __xy_err == __x * __y
+      constexpr double __splitter = 0x1.0000002p27; // 2^27 + 1
+      const _V         __xs       = __x * __splitter;
+      const _V         __xh       = __xs - (__xs - __x);
+      const _V         __xl       = __x - __xh;
+      const _V         __ys       = __y * __splitter;
+      const _V         __yh       = __ys - (__ys - __y);
+      const _V         __yl       = __y - __yh;
+      const _V         __xy       = __x * __y;
+      const _V         __xy_err =
+	((__xh * __yh - __xy) + __xh * __yl + __xl * __yh) + __xl * __yl;
+      // TwoSum: __s + __s_err == __z + __xy
+      const _V __s     = __z + __xy;
+      const _V __bb    = __s - __z;
+      const _V __s_err = (__z - (__s - __bb)) + (__xy - __bb);
+      // Boldo & Melquiond: rounding the sum of the two errors to odd makes
+      // the final addition round __x * __y + __z correctly
+      const _V __v = __add_round_to_odd(__s_err, __xy_err);
+      // The splitting must not overflow and the error terms must neither
+      // over- nor underflow. Everything else, including inf and NaN, and the
+      // directed rounding modes use std::fma.
+      const _V __abs_xy = abs(__xy);
+      if (_GLIBCXX_SIMD_IS_LIKELY(
+	    _MM_GET_ROUNDING_MODE() == _MM_ROUND_NEAREST &&
+	    all_of(abs(__x) < 0x1p995 && abs(__y) < 0x1p995 &&
+		   __abs_xy < 0x1p1020 && abs(__z) < 0x1p1020 &&
+		   (__abs_xy >= 0x1p-968 || __x == 0 || __y == 0) &&
+		   (abs(__s) >= 0x1p-968 || __s == 0))))
+	{
+	  // __v == 0 keeps the sign of a zero __s
+	  _V __r = __s;
+	  where(__v != 0, __r) += __v;
+	  return __r;
+	}
+    }
+#endif // _GLIBCXX_SIMD_X86INTRIN
+  return {__private_init,
+	  _Abi::_SimdImpl::__fma(__data(__x), __data(__y), __data(__z))};
+}
+_GLIBCXX_SIMD_CVTING3(fma)
+
+// }}}
+_GLIBCXX_SIMD_MATH_CALL_(fpclassify)
+_GLIBCXX_SIMD_MATH_CALL_(isfinite)
+
+// isnan and isinf require special treatment because old glibc may declare
+// `int std::isinf(double)`.
+template <class _Tp, class _Abi, class...,
+          class _R = std::experimental::__math_return_type_t<bool, _Tp, _Abi>>
+enable_if_t<std::is_floating_point_v<_Tp>, _R> isinf(
+    std::experimental::simd<_Tp, _Abi> __x)
+{
+  return {std::experimental::__private_init,
+          _Abi::_SimdImpl::__isinf(std::experimental::__data(__x))};
+}
+template <class _Tp, class _Abi, class...,
+          class _R = std::experimental::__math_return_type_t<bool, _Tp, _Abi>>
+enable_if_t<std::is_floating_point_v<_Tp>, _R> isnan(
+    std::experimental::simd<_Tp, _Abi> __x)
+{
+  return {std::experimental::__private_init,
+          _Abi::_SimdImpl::__isnan(std::experimental::__data(__x))};
+}
+_GLIBCXX_SIMD_MATH_CALL_(isnormal)
+
+template <class..., class _Tp, class _Abi>
+std::experimental::simd_mask<_Tp, _Abi>
+  signbit(std::experimental::simd<_Tp, _Abi> __x)
+{
+  if constexpr (std::is_integral_v<_Tp>)
+    {
+      if constexpr (std::is_unsigned_v<_Tp>)
+	return std::experimental::simd_mask<_Tp, _Abi>{}; // false
+      else
+	return __x < 0;
+    }
+  else
+    return {std::experimental::__private_init,
+	    _Abi::_SimdImpl::__signbit(std::experimental::__data(__x))};
+}
+
+_GLIBCXX_SIMD_MATH_CALL2_(isgreater, _Tp)
+_GLIBCXX_SIMD_MATH_CALL2_(isgreaterequal, _Tp)
+_GLIBCXX_SIMD_MATH_CALL2_(isless, _Tp)
+_GLIBCXX_SIMD_MATH_CALL2_(islessequal, _Tp)
+_GLIBCXX_SIMD_MATH_CALL2_(islessgreater, _Tp)
+_GLIBCXX_SIMD_MATH_CALL2_(isunordered, _Tp)
+
+/* not covered in [parallel.simd.math]
+template <class _Abi> __doublev<_Abi> nan(const char* tagp);
+template <class _Abi> __floatv<_Abi> nanf(const char* tagp);
+template <class _Abi> __ldoublev<_Abi> nanl(const char* tagp);
+
+template <class _V> struct simd_div_t {
+    _V quot, rem;
+};
+template <class _Abi>
+simd_div_t<_SCharv<_Abi>> div(_SCharv<_Abi> numer,
+                                         _SCharv<_Abi> denom);
+template <class _Abi>
+simd_div_t<__shortv<_Abi>> div(__shortv<_Abi> numer,
+                                         __shortv<_Abi> denom);
+template <class _Abi>
+simd_div_t<__intv<_Abi>> div(__intv<_Abi> numer, __intv<_Abi> denom);
+template <class _Abi>
+simd_div_t<__longv<_Abi>> div(__longv<_Abi> numer,
+                                        __longv<_Abi> denom);
+template <class _Abi>
+simd_div_t<__llongv<_Abi>> div(__llongv<_Abi> numer,
+                                         __llongv<_Abi> denom);
+*/
+
+// fast_math {{{
+/*
+ * Accuracy tiers:
+ *
+ * The math functions above are the default tier: they handle every input
+ * (NaN, ±inf, ±0, subnormals, over- and underflow, all rounding modes) and
+ * stay within a few ulp of the correctly rounded result.
+ *
+ * __proposed::fast_math provides sin, cos, exp, log, and pow with shorter
+ * polynomials and a single, branch-free code path instead. The results are
+ * only specified for
+ *   sin, cos: |x| <= 8192 (float) or 2^30 (double); absolute error <= 2 ulp(1),
+ *   exp:      |x| <= 87 (float) or 708 (double); error <= 2 ulp,
+ *   log:      finite x > 0; error <= 3 ulp (float) or 2 ulp (double),
+ *   pow:      finite x > 0 and y * log(x) in the domain of exp; error
+ *             <= 2 * (2 + |y * log(x)|) ulp,
+ * and only when rounding to nearest. Otherwise the result is unspecified.
+ */
+namespace __proposed
+{
+namespace fast_math
+{
+// __sinPoly {{{
+/**\internal
+ * Approximates sin(x) for x in [-½π, ½π].
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __sinPoly(const simd<float, _Abi>& __x)
+{
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = 0x1.61a18ap-19f;
+  __y = __y * __x2 - 0x1.9fb686p-13f;
+  __y = __y * __x2 + 0x1.11104ep-7f;
+  __y = __y * __x2 - 0x1.555554p-3f;
+  return __y * (__x2 * __x) + __x;
+}
+
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __sinPoly(const simd<double, _Abi>& __x)
+{
+  const simd<double, _Abi> __x2 = __x * __x;
+  simd<double, _Abi>       __y;
+  __y = 0x1.89a4866f527ebp-49;
+  __y = __y * __x2 - 0x1.ae5138c1216b3p-41;
+  __y = __y * __x2 + 0x1.6124015b5ee3ap-33;
+  __y = __y * __x2 - 0x1.ae6455a1d7087p-26;
+  __y = __y * __x2 + 0x1.71de3a5456716p-19;
+  __y = __y * __x2 - 0x1.a01a01a018aadp-13;
+  __y = __y * __x2 + 0x1.1111111111107p-7;
+  __y = __y * __x2 - 0x1.5555555555555p-3;
+  return __y * (__x2 * __x) + __x;
+}
 
-	// __exponent(__x) returns the exponent value (bias removed) as simd<_U>
-	// with integral _U
-	auto&& __exponent = [](const _V& __v) {
-	  using namespace std::experimental::__proposed;
-	  using _IV = rebind_simd_t<
-	    std::conditional_t<sizeof(_Tp) == sizeof(_LLong), _LLong, int>,
-	    _V>;
-	  return (simd_reinterpret_cast<_IV>(__v) >>
-		  (std::numeric_limits<_Tp>::digits - 1)) -
-		 (std::numeric_limits<_Tp>::max_exponent - 1);
-	};
-	_V __r = static_simd_cast<_V>(__exponent(abs_x));
-	if (_GLIBCXX_SIMD_IS_LIKELY(all_of(__is_normal)))
-	  {
-	    // without corner cases (nan, inf, subnormal, zero) we have our
-	    // answer:
-	    return __r;
-	  }
-	const auto __is_zero  = __x == 0;
-	const auto __is_nan   = isnan(__x);
-	const auto __is_inf   = isinf(__x);
-	where(__is_zero, __r) = -std::numeric_limits<_Tp>::infinity();
-	where(__is_nan, __r)  = __x;
-	where(__is_inf, __r)  = std::numeric_limits<_Tp>::infinity();
-	__is_normal |= __is_zero || __is_nan || __is_inf;
-	if (all_of(__is_normal))
-	  {
-	    // at this point everything but subnormals is handled
-	    return __r;
-	  }
-	// subnormals repeat the exponent extraction after multiplication of the
-	// input with __a floating point value that has 112 (0x70) in its exponent
-	// (not too big for sp and large enough for dp)
-	const _V __scaled = abs_x * _Tp(0x1p112);
-	_V __scaled_exp   = static_simd_cast<_V>(__exponent(__scaled) - 112);
-	where(__is_normal, __scaled_exp) = __r;
-	return __scaled_exp;
-      }
+// }}}
+// __sinShifted {{{
+/**\internal
+ * Returns sin(x) for \p __n = nearbyint(x/π) or, if \p _Cos, cos(x) for
+ * \p __n = nearbyint(x/π - ½).
+ */
+template <bool _Cos, class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
+  __sinShifted(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __n)
+{
+  using _V  = simd<_Tp, _Abi>;
+  using _IV = rebind_simd_t<int, _V>;
+  using namespace std::experimental::__proposed::float_bitwise_operators;
+  // cos(x) = sin(x - (n + ½)π) · (-1)^(n + 1)
+  const _V __h = _Cos ? __n + _Tp(.5) : __n;
+  // π split into three parts, where the products with __h of the first two
+  // are exact for the supported domain
+  _V __r;
+  if constexpr (is_same_v<_Tp, float>)
+    __r = ((__x - __h * 0x1.92p1f) - __h * 0x1.fb4p-11f) -
+	  __h * 0x1.4442d2p-23f;
+  else
+    __r = ((__x - __h * 0x1.921fb8p1) + __h * 0x1.5dde98p-22) -
+	  __h * 0x1.8469898cc5170p-47;
+  const _V __sign =
+    static_simd_cast<_V>((static_simd_cast<_IV>(__n) + int(_Cos)) << 31) &
+    _V(_Tp(-0.));
+  return __sinPoly(__r) ^ __sign;
 }
-//}}}
-template <typename _Tp, typename _Abi>
+
+// }}}
+// sin {{{
+template <class _Tp, class _Abi>
 enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
-  modf(const simd<_Tp, _Abi>& __x, simd<_Tp, _Abi>* __iptr)
+  sin(const simd<_Tp, _Abi>& __x)
 {
-  const auto __integral = trunc(__x);
-  *__iptr = __integral;
-  auto __r = __x - __integral;
-  where(isinf(__x), __r) = _Tp();
-  return copysign(__r, __x);
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_apply<_V>([](auto __a) { return fast_math::sin(__a); },
+				  __x);
+  else
+    {
+      constexpr _Tp __1_over_pi =
+	sizeof(_Tp) == 4 ? 0x1.45f306p-2f : 0x1.45f306dc9c883p-2; // 1/π
+      return __sinShifted<false>(__x, nearbyint(__x * __1_over_pi));
+    }
 }
 
-_GLIBCXX_SIMD_MATH_CALL2_(scalbn, int)
-_GLIBCXX_SIMD_MATH_CALL2_(scalbln, long)
+// }}}
+// cos {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  cos(const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_apply<_V>([](auto __a) { return fast_math::cos(__a); },
+				  __x);
+  else
+    {
+      constexpr _Tp __1_over_pi =
+	sizeof(_Tp) == 4 ? 0x1.45f306p-2f : 0x1.45f306dc9c883p-2; // 1/π
+      return __sinShifted<true>(__x,
+				nearbyint(__x * __1_over_pi - _Tp(.5)));
+    }
+}
 
-_GLIBCXX_SIMD_MATH_CALL_(cbrt)
+// }}}
+// __expPoly {{{
+/**\internal
+ * Approximates e^x for x in [-½ln2, ½ln2].
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __expPoly(const simd<float, _Abi>& __x)
+{
+  simd<float, _Abi> __y;
+  __y = 0x1.6d10fcp-10f;
+  __y = __y * __x + 0x1.120b62p-7f;
+  __y = __y * __x + 0x1.55551ap-5f;
+  __y = __y * __x + 0x1.5554dep-3f;
+  __y = __y * __x + 0x1p-1f;
+  return (__y * (__x * __x) + __x) + 1;
+}
 
-_GLIBCXX_SIMD_MATH_CALL_(abs)
-_GLIBCXX_SIMD_MATH_CALL_(fabs)
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __expPoly(const simd<double, _Abi>& __x)
+{
+  simd<double, _Abi> __y;
+  __y = 0x1.af389ecfc4b9cp-26;
+  __y = __y * __x + 0x1.28917c89a43a7p-22;
+  __y = __y * __x + 0x1.71de0db2f6b19p-19;
+  __y = __y * __x + 0x1.a019b9149a41cp-16;
+  __y = __y * __x + 0x1.a01a01a7c2efep-13;
+  __y = __y * __x + 0x1.6c16c17889ef1p-10;
+  __y = __y * __x + 0x1.11111111109b5p-7;
+  __y = __y * __x + 0x1.5555555553d68p-5;
+  __y = __y * __x + 0x1.5555555555556p-3;
+  __y = __y * __x + 0x1.0000000000001p-1;
+  return (__y * (__x * __x) + __x) + 1;
+}
 
-// [parallel.simd.math] only asks for is_floating_point_v<_Tp> and forgot to allow
-// signed integral _Tp
+// }}}
+// exp {{{
 template <class _Tp, class _Abi>
-enable_if_t<!std::is_floating_point_v<_Tp> && std::is_signed_v<_Tp>, simd<_Tp, _Abi>> abs(
-    const simd<_Tp, _Abi> &__x)
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  exp(const simd<_Tp, _Abi>& __x)
 {
-    return {__private_init, _Abi::_SimdImpl::__abs(__data(__x))};
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_apply<_V>([](auto __a) { return fast_math::exp(__a); },
+				  __x);
+  else
+    {
+      constexpr bool __f = sizeof(_Tp) == 4;
+      constexpr _Tp  __log2e =
+	__f ? __math_float::__log2e : __math_double::__log2e;
+      constexpr _Tp  __ln2_hi =
+	__f ? __math_float::__ln2_hi : __math_double::__ln2_hi;
+      constexpr _Tp  __ln2_lo =
+	__f ? __math_float::__ln2_lo : __math_double::__ln2_lo;
+      const _V __n = nearbyint(__x * __log2e);
+      return __expPoly((__x - __n * __ln2_hi) - __n * __ln2_lo) *
+	     __make_pow2(__n);
+    }
+}
+
+// }}}
+// __logPoly {{{
+/**\internal
+ * Approximates log(1 + x) - x for x in [√½ - 1, √2 - 1).
+ */
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<float, _Abi>
+  __logPoly(const simd<float, _Abi>& __x)
+{
+  const simd<float, _Abi> __x2 = __x * __x;
+  simd<float, _Abi>       __y;
+  __y = 0x1.72a362p-4f;
+  __y = __y * __x - 0x1.1f5a48p-3f;
+  __y = __y * __x + 0x1.2d22c8p-3f;
+  __y = __y * __x - 0x1.54061p-3f;
+  __y = __y * __x + 0x1.9946e2p-3f;
+  __y = __y * __x - 0x1.0001d8p-2f;
+  __y = __y * __x + 0x1.55558cp-2f;
+  return __y * __x * __x2 - .5f * __x2;
 }
+
+// the rational approximation of the default tier is faster than a polynomial
+// of the required degree
+template <typename _Abi>
+_GLIBCXX_SIMD_ALWAYS_INLINE static simd<double, _Abi>
+  __logPoly(const simd<double, _Abi>& __x)
+{ return __logSeries(__x); }
+
+// }}}
+// log {{{
 template <class _Tp, class _Abi>
-enable_if_t<!std::is_floating_point_v<_Tp> && std::is_signed_v<_Tp>, simd<_Tp, _Abi>> fabs(
-    const simd<_Tp, _Abi> &__x)
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  log(const simd<_Tp, _Abi>& __x)
 {
-    return {__private_init, _Abi::_SimdImpl::__abs(__data(__x))};
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_apply<_V>([](auto __a) { return fast_math::log(__a); },
+				  __x);
+  else
+    {
+      constexpr _Tp __ln2_hi =
+	sizeof(_Tp) == 4 ? __math_float::__ln2_hi : __math_double::__ln2_hi;
+      constexpr _Tp __ln2_lo =
+	sizeof(_Tp) == 4 ? __math_float::__ln2_lo : __math_double::__ln2_lo;
+      const auto __s = __split_mantissa(__x);
+      return ((__logPoly(__s._M_m) + __s._M_e * __ln2_lo) + __s._M_m) +
+	     __s._M_e * __ln2_hi;
+    }
 }
 
-// the following are overloads for functions in <cstdlib> and not covered by
-// [parallel.simd.math]. I don't see much value in making them work, though
+// }}}
+// pow {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  pow(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+{
+  return fast_math::exp(__y * fast_math::log(__x));
+}
+
+// }}}
+} // namespace fast_math
+} // namespace __proposed
+
+// }}}
+// rcp, rsqrt {{{
 /*
-template <class _Abi> simd<long, _Abi> labs(const simd<long, _Abi> &__x)
+ * __proposed::rcp(x) and __proposed::rsqrt(x) approximate 1/x and 1/√x
+ * without a division: the hardware estimate (rcpps/rsqrtps with 11, or
+ * rcp14/rsqrt14 with AVX-512 with 14 correct bits) is refined with
+ * _NewtonSteps Newton-Raphson steps, each of which about doubles the number of
+ * correct bits. The default number of steps yields an error <= 4 ulp. If there
+ * is no estimate instruction for the ABI (scalar, double without AVX-512, no
+ * x86), the result is 1/x and 1/sqrt(x) instead.
+ *
+ * The results are only specified for finite x != 0 with a normal 1/x (rcp),
+ * and for normal x > 0 (rsqrt).
+ */
+// __rcp_estimate_bits {{{
+/**\internal
+ * The number of correct bits of __rcp_estimate, or 0 if there is no estimate
+ * instruction for \p _Tp and \p _N elements.
+ */
+template <class _Tp, size_t _N> constexpr int __rcp_estimate_bits()
 {
-    return {__private_init, _Abi::_SimdImpl::abs(__data(__x))};
+#if _GLIBCXX_SIMD_X86INTRIN
+  if constexpr (__is_avx512_ps<_Tp, _N>() || __is_avx512_pd<_Tp, _N>())
+    return 14;
+  else if constexpr (__have_avx512vl &&
+		     (__is_sse_ps<_Tp, _N>() || __is_avx_ps<_Tp, _N>()))
+    return 14;
+  else if constexpr (__have_avx512f &&
+		     (__is_sse_pd<_Tp, _N>() || __is_avx_pd<_Tp, _N>()))
+    return 14;
+  else if constexpr (__is_sse_ps<_Tp, _N>() || __is_avx_ps<_Tp, _N>())
+    return 11;
+  else
+#endif // _GLIBCXX_SIMD_X86INTRIN
+    return 0;
 }
-template <class _Abi> simd<long long, _Abi> llabs(const simd<long long, _Abi> &__x)
+
+// }}}
+#if _GLIBCXX_SIMD_X86INTRIN
+// __rcp_estimate {{{
+/**\internal
+ * Returns the hardware estimate of 1/x, or of 1/√x if \p _Sqrt.
+ */
+template <bool _Sqrt, class _Tp, size_t _N>
+_GLIBCXX_SIMD_INTRINSIC _SimdWrapper<_Tp, _N>
+			__rcp_estimate(_SimdWrapper<_Tp, _N> __x)
 {
-    return {__private_init, _Abi::_SimdImpl::abs(__data(__x))};
+  if constexpr (__have_avx512vl && __is_sse_ps<_Tp, _N>())
+    return _Sqrt ? _mm_rsqrt14_ps(__x) : _mm_rcp14_ps(__x);
+  else if constexpr (__is_sse_ps<_Tp, _N>())
+    return _Sqrt ? _mm_rsqrt_ps(__x) : _mm_rcp_ps(__x);
+  else if constexpr (__have_avx512vl && __is_sse_pd<_Tp, _N>())
+    return _Sqrt ? _mm_rsqrt14_pd(__x) : _mm_rcp14_pd(__x);
+  else if constexpr (__have_avx512f && __is_sse_pd<_Tp, _N>())
+    return __lo128(_Sqrt ? _mm512_rsqrt14_pd(__auto_bitcast(__x))
+			 : _mm512_rcp14_pd(__auto_bitcast(__x)));
+  else if constexpr (__have_avx512vl && __is_avx_ps<_Tp, _N>())
+    return _Sqrt ? _mm256_rsqrt14_ps(__x) : _mm256_rcp14_ps(__x);
+  else if constexpr (__is_avx_ps<_Tp, _N>())
+    return _Sqrt ? _mm256_rsqrt_ps(__x) : _mm256_rcp_ps(__x);
+  else if constexpr (__have_avx512vl && __is_avx_pd<_Tp, _N>())
+    return _Sqrt ? _mm256_rsqrt14_pd(__x) : _mm256_rcp14_pd(__x);
+  else if constexpr (__have_avx512f && __is_avx_pd<_Tp, _N>())
+    return __lo256(_Sqrt ? _mm512_rsqrt14_pd(__auto_bitcast(__x))
+			 : _mm512_rcp14_pd(__auto_bitcast(__x)));
+  else if constexpr (__is_avx512_ps<_Tp, _N>())
+    return _Sqrt ? _mm512_rsqrt14_ps(__x) : _mm512_rcp14_ps(__x);
+  else if constexpr (__is_avx512_pd<_Tp, _N>())
+    return _Sqrt ? _mm512_rsqrt14_pd(__x) : _mm512_rcp14_pd(__x);
+  else
+    __assert_unreachable<_Tp>();
 }
-*/
 
-#define _GLIBCXX_SIMD_CVTING2(_NAME)                                           \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const simd<_Tp, _Abi>& __x, const __id<simd<_Tp, _Abi>>& __y)              \
-  {                                                                            \
-    return _NAME(__x, __y);                                                    \
-  }                                                                            \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const __id<simd<_Tp, _Abi>>& __x, const simd<_Tp, _Abi>& __y)              \
-  {                                                                            \
-    return _NAME(__x, __y);                                                    \
-  }
+// }}}
+#endif // _GLIBCXX_SIMD_X86INTRIN
+// __newton_steps {{{
+/**\internal
+ * Returns \p _Steps, or for a negative \p _Steps the number of Newton-Raphson
+ * steps that turn \p _EstimateBits correct bits into at least digits - 2.
+ */
+template <int _Steps, int _EstimateBits, class _Tp>
+constexpr int __newton_steps()
+{
+  if constexpr (_Steps >= 0)
+    return _Steps;
+  else
+    {
+      int __n = 0;
+      for (int __bits = _EstimateBits;
+	   __bits < std::numeric_limits<_Tp>::digits - 2; __bits *= 2)
+	++__n;
+      return __n;
+    }
+}
 
-#define _GLIBCXX_SIMD_CVTING3(_NAME)                                           \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const __id<simd<_Tp, _Abi>>& __x, const simd<_Tp, _Abi>& __y,              \
-    const simd<_Tp, _Abi>& __z)                                                \
-  {                                                                            \
-    return _NAME(__x, __y, __z);                                               \
-  }                                                                            \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const simd<_Tp, _Abi>& __x, const __id<simd<_Tp, _Abi>>& __y,              \
-    const simd<_Tp, _Abi>& __z)                                                \
-  {                                                                            \
-    return _NAME(__x, __y, __z);                                               \
-  }                                                                            \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y,                    \
-    const __id<simd<_Tp, _Abi>>& __z)                                          \
-  {                                                                            \
-    return _NAME(__x, __y, __z);                                               \
-  }                                                                            \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const simd<_Tp, _Abi>& __x, const __id<simd<_Tp, _Abi>>& __y,              \
-    const __id<simd<_Tp, _Abi>>& __z)                                          \
-  {                                                                            \
-    return _NAME(__x, __y, __z);                                               \
-  }                                                                            \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const __id<simd<_Tp, _Abi>>& __x, const simd<_Tp, _Abi>& __y,              \
-    const __id<simd<_Tp, _Abi>>& __z)                                          \
-  {                                                                            \
-    return _NAME(__x, __y, __z);                                               \
-  }                                                                            \
-  template <typename _Tp, typename _Abi>                                       \
-  _GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> _NAME(                               \
-    const __id<simd<_Tp, _Abi>>& __x, const __id<simd<_Tp, _Abi>>& __y,        \
-    const simd<_Tp, _Abi>& __z)                                                \
-  {                                                                            \
-    return _NAME(__x, __y, __z);                                               \
-  }
+// }}}
+namespace __proposed
+{
+// rcp {{{
+template <int _NewtonSteps = -1, class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  rcp(const simd<_Tp, _Abi>& __x)
+{
+  using _V              = simd<_Tp, _Abi>;
+  constexpr int __bits = __rcp_estimate_bits<_Tp, simd_size_v<_Tp, _Abi>>();
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_apply<_V>(
+      [](auto __a) { return __proposed::rcp<_NewtonSteps>(__a); }, __x);
+  else if constexpr (__bits == 0)
+    return _Tp(1) / __x;
+  else
+    {
+#if _GLIBCXX_SIMD_X86INTRIN
+      _V __r = {__private_init, __rcp_estimate<false>(__data(__x))};
+      // r' = r + r(1 - xr) squares the relative error of r
+      for (int __i = 0; __i < __newton_steps<_NewtonSteps, __bits, _Tp>();
+	   ++__i)
+	__r += __r * (1 - __x * __r);
+      return __r;
+#endif // _GLIBCXX_SIMD_X86INTRIN
+    }
+}
 
-template <typename _R, typename _ToApply, typename _Tp, typename... _Tps>
-_GLIBCXX_SIMD_INTRINSIC _R __fixed_size_apply(_ToApply&& __apply,
-					      const _Tp& __arg0,
-					      const _Tps&... __args)
+// }}}
+// rsqrt {{{
+template <int _NewtonSteps = -1, class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  rsqrt(const simd<_Tp, _Abi>& __x)
 {
-  return {__private_init, __data(__arg0).__apply_per_chunk(
-			    [&](auto __impl, const auto&... __inner) {
-			      using _V = typename decltype(__impl)::simd_type;
-			      return __data(__apply(_V(__private_init, __inner)...));
-			    },
-			    __data(__args)...)};
+  using _V              = simd<_Tp, _Abi>;
+  constexpr int __bits = __rcp_estimate_bits<_Tp, simd_size_v<_Tp, _Abi>>();
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    return __fixed_size_apply<_V>(
+      [](auto __a) { return __proposed::rsqrt<_NewtonSteps>(__a); }, __x);
+  else if constexpr (__bits == 0)
+    return _Tp(1) / sqrt(__x);
+  else
+    {
+#if _GLIBCXX_SIMD_X86INTRIN
+      _V __r = {__private_init, __rcp_estimate<true>(__data(__x))};
+      // r' = r + ½r(1 - xr²) about squares the relative error of r
+      for (int __i = 0; __i < __newton_steps<_NewtonSteps, __bits, _Tp>();
+	   ++__i)
+	__r += (_Tp(.5) * __r) * (1 - (__x * __r) * __r);
+      return __r;
+#endif // _GLIBCXX_SIMD_X86INTRIN
+    }
+}
+
+// }}}
+// polynomial {{{
+/**
+ * Evaluation schemes for polynomial. For n coefficients, horner needs n - 1
+ * multiply-adds, each depending on the previous one. estrin evaluates
+ * independent pairs of coefficients and combines them with x², x⁴, …, i.e.
+ * about ⌈log2(n)⌉ dependent multiply-adds (plus the squarings, which overlap
+ * with the first level) at the cost of ⌈log2(n)⌉ - 1 extra multiplications.
+ * Thus estrin wins where the polynomial is on the critical path and horner
+ * where throughput matters.
+ */
+struct horner {};
+struct estrin {};
+
+/**\internal
+ * Returns __a * __b + __c, fused if the target has an FMA instruction.
+ */
+template <class _V>
+_GLIBCXX_SIMD_INTRINSIC _V __muladd(const _V& __a, const _V& __b, const _V& __c)
+{
+  if constexpr (__have_fma || __have_fma4)
+    return fma(__a, __b, __c);
+  else
+    return __a * __b + __c;
+}
+
+/**\internal
+ * Horner scheme for the coefficients __c[_First] … __c[_N - 1].
+ */
+template <size_t _First, size_t _N, class _V, class _Tp>
+_GLIBCXX_SIMD_INTRINSIC _V __horner(const _V& __x, const _Tp (&__c)[_N])
+{
+  if constexpr (_First == _N - 1)
+    return __c[_First];
+  else
+    return __muladd(__horner<_First + 1>(__x, __c), __x, _V(__c[_First]));
 }
 
-template <typename _VV> __remove_cvref_t<_VV> __hypot(_VV __x, _VV __y)
+/**\internal
+ * Estrin scheme for the _Count coefficients starting at __c[_First], where
+ * __x2k[__k] holds x^(2^__k).
+ */
+template <size_t _First, size_t _Count, class _V, class _Tp, size_t _N,
+	  size_t _P>
+_GLIBCXX_SIMD_INTRINSIC _V __estrin(const _V (&__x2k)[_P],
+				    const _Tp (&__c)[_N])
 {
-  using _V = __remove_cvref_t<_VV>;
-  using _Tp = typename _V::value_type;
-  if constexpr (_V::size() == 1)
-    {
-      return std::hypot(_Tp(__x[0]), _Tp(__y[0]));
-    }
-  else if constexpr (__is_fixed_size_abi_v<typename _V::abi_type>)
+  if constexpr (_Count == 1)
+    return __c[_First];
+  else
     {
-      return __fixed_size_apply<_V>(
-	[](auto __a, auto __b) { return hypot(__a, __b); }, __x, __y);
+      // split off the largest power of two below _Count as the low part
+      constexpr size_t __k = [] {
+	size_t __r = 0;
+	while ((size_t(2) << __r) < _Count)
+	  ++__r;
+	return __r;
+      }();
+      constexpr size_t __h = size_t(1) << __k;
+      return __muladd(__estrin<_First + __h, _Count - __h>(__x2k, __c),
+		      __x2k[__k], __estrin<_First, __h>(__x2k, __c));
     }
+}
+
+/**
+ * Returns \p __coeffs[0] + \p __coeffs[1] x + \p __coeffs[2] x² + …, evaluated
+ * with the \p _Scheme horner or estrin. The multiply-adds are fused if the
+ * target supports FMA, which makes the result differ from the unfused
+ * expression in the last bit.
+ */
+template <class _Scheme = horner, class _Tp, class _Abi, class... _Coeffs>
+_GLIBCXX_SIMD_INTRINSIC
+  enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  polynomial(const simd<_Tp, _Abi>& __x, _Coeffs... __coeffs)
+{
+  static_assert(sizeof...(_Coeffs) > 0, "polynomial needs a coefficient");
+  static_assert((std::is_arithmetic_v<_Coeffs> && ...),
+		"the coefficients must be arithmetic constants");
+  static_assert(std::is_same_v<_Scheme, horner> ||
+		  std::is_same_v<_Scheme, estrin>,
+		"_Scheme must be horner or estrin");
+  using _V                   = simd<_Tp, _Abi>;
+  constexpr size_t __n       = sizeof...(_Coeffs);
+  const _Tp        __c[__n] = {static_cast<_Tp>(__coeffs)...};
+  if constexpr (__n == 1 || std::is_same_v<_Scheme, horner>)
+    return __horner<0>(__x, __c);
   else
     {
-      // A simple solution for _Tp == float would be to cast to double and simply calculate
-      // sqrt(x²+y²) as it can't over-/underflow anymore with dp. It still needs the Annex F fixups
-      // though and isn't faster on Skylake-AVX512 (not even for SSE and AVX vectors, and really bad
-      // for AVX-512).
-      using namespace __proposed::float_bitwise_operators;
-      using _Limits = std::numeric_limits<_Tp>;
-      _V __absx     = abs(__x);            // no error
-      _V __absy     = abs(__y);            // no error
-      _V __hi       = max(__absx, __absy); // no error
-      _V __lo       = min(__absy, __absx); // no error
-
-      // round __hi down to the next power-of-2:
-      constexpr _V __inf(_Limits::infinity());
-
-      if (_GLIBCXX_SIMD_IS_LIKELY(all_of(isnormal(__x)) &&
-				  all_of(isnormal(__y))))
-	{
-	  const _V     __hi_exp    = __hi & __inf;
-	  //((__hi + __hi) & __inf) ^ __inf almost works for computing __scale, except
-	  //when (__hi + __hi) & __inf == __inf, in which case __scale becomes 0 (should
-	  //be min/2 instead) and thus loses the information from __lo.
-	  const _V     __scale     = (__hi_exp ^ __inf) * _Tp(.5);
-	  constexpr _V __mant_mask = _Limits::min() - _Limits::denorm_min();
-	  const _V     __h1        = (__hi & __mant_mask) | _V(1);
-	  const _V     __l1        = __lo * __scale;
-	  return __hi_exp * sqrt(__h1 * __h1 + __l1 * __l1);
-	}
-      else
-	{
-	  // slower path to support subnormals
-	  // if __hi is subnormal, avoid scaling by inf & final mul by 0 (which
-	  // yields NaN) by using min()
-	  _V __scale = _V(1 / _Limits::min());
-	  // invert exponent w/o error and w/o using the slow divider unit:
-	  // xor inverts the exponent but off by 1. Multiplication with .5
-	  // adjusts for the discrepancy.
-	  where(__hi >= _Limits::min(), __scale) =
-	    ((__hi & __inf) ^ __inf) * _Tp(.5);
-	  // adjust final exponent for subnormal inputs
-	  _V __hi_exp                             = _Limits::min();
-	  where(__hi >= _Limits::min(), __hi_exp) = __hi & __inf; // no error
-	  _V __h1 = __hi * __scale; // no error
-	  _V __l1 = __lo * __scale; // no error
-
-	  // sqrt(x²+y²) = e*sqrt((x/e)²+(y/e)²):
-	  // this ensures no overflow in the argument to sqrt
-	  _V __r = __hi_exp * sqrt(__h1 * __h1 + __l1 * __l1);
-#ifdef __STDC_IEC_559__
-	  // fixup for Annex F requirements
-	  // the naive fixup goes like this:
-	  //
-	  // where(__l1 == 0, __r)                      = __hi;
-	  // where(isunordered(__x, __y), __r)          = _Limits::quiet_NaN();
-	  // where(isinf(__absx) || isinf(__absy), __r) = __inf;
-	  //
-	  // The fixup can be prepared in parallel with the sqrt, requiring a single blend
-	  // step after hi_exp * sqrt, reducing latency and throughput:
-	  _V __fixup                                     = __hi; // __lo == 0
-	  where(isunordered(__x, __y), __fixup)          = _Limits::quiet_NaN();
-	  where(isinf(__absx) || isinf(__absy), __fixup) = __inf;
-	  where(!(__lo == 0 || isunordered(__x, __y) ||
-		  (isinf(__absx) || isinf(__absy))),
-		__fixup)                                 = __r;
-	  __r                                            = __fixup;
-#endif
-	  return __r;
-	}
+      // x, x², x⁴, … up to the highest power the splits in __estrin use
+      constexpr size_t __p = [] {
+	size_t __r = 1;
+	while ((size_t(2) << (__r - 1)) < __n)
+	  ++__r;
+	return __r;
+      }();
+      _V __x2k[__p] = {__x};
+      for (size_t __i = 1; __i < __p; ++__i)
+	__x2k[__i] = __x2k[__i - 1] * __x2k[__i - 1];
+      return __estrin<0, __n>(__x2k, __c);
     }
 }
 
-template <typename _Tp, typename _Abi>
-_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi>
-			hypot(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+// }}}
+// compensated summation {{{
+/**
+ * Pass to reduce to sum the elements with compensation: the rounding error of
+ * every addition is computed exactly (__two_sum) and summed separately, and
+ * the two sums are only added at the end. The result is about as accurate as
+ * summing in twice the precision of the value_type.
+ * When used as a plain binary operation it is std::plus<>.
+ * Requires rounding to nearest and no -fassociative-math (-ffast-math).
+ */
+struct compensated_plus
 {
-  return __hypot<conditional_t<__is_fixed_size_abi_v<_Abi>,
-			       const simd<_Tp, _Abi>&, simd<_Tp, _Abi>>>(__x,
-									 __y);
-}
-_GLIBCXX_SIMD_CVTING2(hypot)
+  template <class _Tp>
+  _GLIBCXX_SIMD_INTRINSIC constexpr _Tp operator()(const _Tp& __a,
+						    const _Tp& __b) const
+  {
+    return __a + __b;
+  }
+};
 
-template <typename _VV> __remove_cvref_t<_VV> __hypot(_VV __x, _VV __y, _VV __z)
+/**\internal
+ * Returns the compensated sum of all elements of \p __s and \p __err by
+ * halving the vectors and adding the halves with __two_sum.
+ */
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC __hi_lo<_Tp, simd_abi::scalar>
+			__compensated_reduce(const simd<_Tp, _Abi>& __s,
+					     const simd<_Tp, _Abi>& __err)
 {
-  using _V = __remove_cvref_t<_VV>;
-  using _Abi = typename _V::abi_type;
-  using _Tp = typename _V::value_type;
-  /* FIXME: enable after PR77776 is resolved
-  if constexpr (_V::size() == 1)
-    {
-      return std::hypot(_Tp(__x[0]), _Tp(__y[0]), _Tp(__z[0]));
-    }
-  else
-  */
-  if constexpr (__is_fixed_size_abi_v<_Abi> && _V::size() > 1)
+  constexpr size_t _N = simd_size_v<_Tp, _Abi>;
+  if constexpr (_N == 1)
+    return {__s[0], __err[0]};
+  else if constexpr (_N % 2 == 1)
     {
-      return __fixed_size_apply<simd<_Tp, _Abi>>(
-	[](auto __a, auto __b, auto __c) { return hypot(__a, __b, __c); }, __x,
-	__y, __z);
+      const auto [__s0, __s1] = split<_N - 1, 1>(__s);
+      const auto [__e0, __e1] = split<_N - 1, 1>(__err);
+      const auto __r0 = __compensated_reduce(__s0, __e0);
+      const auto __r  = __two_sum(__r0._M_hi, __s1);
+      return {__r._M_hi, __r._M_lo + (__r0._M_lo + __e1)};
     }
   else
     {
-      using namespace __proposed::float_bitwise_operators;
-      using _Limits = std::numeric_limits<_Tp>;
-      const _V __absx     = abs(__x);                         // no error
-      const _V __absy     = abs(__y);                         // no error
-      const _V __absz     = abs(__z);                         // no error
-      _V __hi       = max(max(__absx, __absy), __absz); // no error
-      _V __l0       = min(__absz, max(__absx, __absy)); // no error
-      _V __l1       = min(__absy, __absx);              // no error
-      if constexpr (numeric_limits<_Tp>::digits == 64 &&
-		    numeric_limits<_Tp>::max_exponent == 0x4000 &&
-		    numeric_limits<_Tp>::min_exponent == -0x3FFD &&
-		    _V::size() == 1)
-	{ // Seems like x87 fp80, where bit 63 is always 1 unless subnormal or
-	  // NaN. In this case the bit-tricks don't work, they require IEC559
-	  // binary32 or binary64 format.
-#ifdef __STDC_IEC_559__
-	  // fixup for Annex F requirements
-	  if (isinf(__absx[0]) || isinf(__absy[0]) || isinf(__absz[0]))
-	    return _Limits::infinity();
-	  else if (isunordered(__absx[0], __absy[0]+__absz[0]))
-	    return _Limits::quiet_NaN();
-	  else if (__l0[0] == 0 && __l1[0] == 0)
-	    return __hi;
-#endif
-	  _V            __hi_exp = __hi;
-	  const _ULLong __tmp    = 0x8000'0000'0000'0000ull;
-	  std::memcpy(&__hi_exp, &__tmp, 8);
-	  const _V __scale = 1 / __hi_exp;
-	  __hi *= __scale;
-	  __l0 *= __scale;
-	  __l1 *= __scale;
-	  return __hi_exp * sqrt((__l0 * __l0 + __l1 * __l1) + __hi * __hi);
-	}
-      else
-	{
-	  // round __hi down to the next power-of-2:
-	  constexpr _V __inf(_Limits::infinity());
-
-	  if (_GLIBCXX_SIMD_IS_LIKELY(all_of(isnormal(__x)) &&
-				      all_of(isnormal(__y)) &&
-				      all_of(isnormal(__z))))
-	    {
-	      const _V __hi_exp = __hi & __inf;
-	      //((__hi + __hi) & __inf) ^ __inf almost works for computing
-	      //__scale, except when (__hi + __hi) & __inf == __inf, in which
-	      // case __scale
-	      // becomes 0 (should be min/2 instead) and thus loses the
-	      // information from __lo.
-	      const _V     __scale     = (__hi_exp ^ __inf) * _Tp(.5);
-	      constexpr _V __mant_mask = _Limits::min() - _Limits::denorm_min();
-	      const _V     __h1        = (__hi & __mant_mask) | _V(1);
-	      __l0 *= __scale;
-	      __l1 *= __scale;
-	      const _V __lo =
-		__l0 * __l0 + __l1 * __l1; // add the two smaller values first
-	      return __hi_exp * sqrt(__lo + __h1 * __h1);
-	    }
-	  else
-	    {
-	      // slower path to support subnormals
-	      // if __hi is subnormal, avoid scaling by inf & final mul by 0
-	      // (which yields NaN) by using min()
-	      _V __scale = _V(1 / _Limits::min());
-	      // invert exponent w/o error and w/o using the slow divider unit:
-	      // xor inverts the exponent but off by 1. Multiplication with .5
-	      // adjusts for the discrepancy.
-	      where(__hi >= _Limits::min(), __scale) =
-		((__hi & __inf) ^ __inf) * _Tp(.5);
-	      // adjust final exponent for subnormal inputs
-	      _V __hi_exp = _Limits::min();
-	      where(__hi >= _Limits::min(), __hi_exp) =
-		__hi & __inf;           // no error
-	      _V __h1 = __hi * __scale; // no error
-	      __l0 *= __scale;          // no error
-	      __l1 *= __scale;          // no error
-	      _V __lo =
-		__l0 * __l0 + __l1 * __l1; // add the two smaller values first
-	      _V __r = __hi_exp * sqrt(__lo + __h1 * __h1);
-#ifdef __STDC_IEC_559__
-	      // fixup for Annex F requirements
-	      _V __fixup = __hi; // __lo == 0
-	      // where(__lo == 0, __fixup)                   = __hi;
-	      where(isunordered(__x, __y + __z), __fixup) =
-		_Limits::quiet_NaN();
-	      where(isinf(__absx) || isinf(__absy) || isinf(__absz), __fixup) =
-		__inf;
-	      where(!(__lo == 0 || isunordered(__x, __y + __z) ||
-		      isinf(__absx) || isinf(__absy) || isinf(__absz)),
-		    __fixup) = __r;
-	      __r            = __fixup;
-#endif
-	      return __r;
-	    }
-	}
+      const auto [__s0, __s1] = split<_N / 2, _N / 2>(__s);
+      const auto [__e0, __e1] = split<_N / 2, _N / 2>(__err);
+      const auto __r          = __two_sum(__s0, __s1);
+      return __compensated_reduce(__r._M_hi, __r._M_lo + (__e0 + __e1));
     }
 }
 
-template <typename _Tp, typename _Abi>
-_GLIBCXX_SIMD_INTRINSIC simd<_Tp, _Abi> hypot(const simd<_Tp, _Abi>& __x,
-					      const simd<_Tp, _Abi>& __y,
-					      const simd<_Tp, _Abi>& __z)
+/**
+ * Accumulates a range of floating-point values chunk by chunk into \p _V
+ * with per-lane compensation: every lane keeps the running sum and the sum of
+ * the rounding errors (Neumaier). The result is about as accurate as summing
+ * in twice the precision, i.e. floats can stay in float vectors instead of
+ * being widened to double, and doubles gain precision no wider vector type
+ * offers. Each value costs six additions instead of one, but only one of them
+ * is on the dependency chain of the running sum. Requires rounding to nearest
+ * and no -fassociative-math (-ffast-math).
+ */
+template <class _V> class compensated_accumulator
 {
-  return __hypot<conditional_t<__is_fixed_size_abi_v<_Abi>,
-			       const simd<_Tp, _Abi>&, simd<_Tp, _Abi>>>(
-    __x, __y, __z);
+  static_assert(is_simd_v<_V> &&
+		  std::is_floating_point_v<typename _V::value_type>,
+		"compensated_accumulator requires a floating-point simd type");
+
+  _V _M_sum = {};
+  _V _M_err = {};
+
+public:
+  using simd_type  = _V;
+  using value_type = typename _V::value_type;
+
+  compensated_accumulator() = default;
+
+  _GLIBCXX_SIMD_INTRINSIC compensated_accumulator& operator+=(const _V& __x)
+  {
+    const auto __r = __two_sum(_M_sum, __x);
+    _M_sum         = __r._M_hi;
+    _M_err += __r._M_lo;
+    return *this;
+  }
+
+  // merges the partial sums of another accumulator, e.g. from another thread
+  _GLIBCXX_SIMD_INTRINSIC compensated_accumulator&
+    operator+=(const compensated_accumulator& __rhs)
+  {
+    const auto __r = __two_sum(_M_sum, __rhs._M_sum);
+    _M_sum         = __r._M_hi;
+    _M_err += __r._M_lo + __rhs._M_err;
+    return *this;
+  }
+
+  // the compensated sum of each lane
+  _GLIBCXX_SIMD_INTRINSIC _V sum() const { return _M_sum + _M_err; }
+
+  // the compensated sum of all lanes
+  _GLIBCXX_SIMD_INTRINSIC value_type reduce() const
+  {
+    const auto __r = __compensated_reduce(_M_sum, _M_err);
+    return __r._M_hi[0] + __r._M_lo[0];
+  }
+};
+
+// }}}
+} // namespace __proposed
+
+// reduce(simd, compensated_plus) {{{
+template <class _Tp, class _Abi>
+_GLIBCXX_SIMD_INTRINSIC enable_if_t<std::is_floating_point_v<_Tp>, _Tp>
+			reduce(const simd<_Tp, _Abi>& __v,
+			       __proposed::compensated_plus)
+{
+  const auto __r = __proposed::__compensated_reduce(__v, simd<_Tp, _Abi>());
+  return __r._M_hi[0] + __r._M_lo[0];
 }
-_GLIBCXX_SIMD_CVTING3(hypot)
 
-_GLIBCXX_SIMD_MATH_CALL2_(pow, _Tp)
+// }}}
+// denormal_mode {{{
+namespace __proposed
+{
+/**
+ * Switches the floating-point unit of the calling thread to flush subnormal
+ * values to zero for the lifetime of the object and restores the previous
+ * mode on destruction. Operations with subnormal inputs or results take a
+ * microcode assist on x86 (~100 cycles, for the whole vector, even if a single
+ * lane is subnormal); with this mode they run at full speed and return zero
+ * (or ±0-based results) instead.
+ *
+ * \param __flush_to_zero     subnormal results are replaced by zero
+ *                            (MXCSR.FTZ; FPCR/FPSCR.FZ on ARM)
+ * \param __denormals_are_zero subnormal inputs are read as zero (MXCSR.DAZ;
+ *                            ARM's FZ bit covers both, so this is ignored there)
+ *
+ * The mode is not part of the abstract machine: the compiler may move
+ * floating-point operations across the constructor and destructor, exactly as
+ * for fesetround. Keep the guarded region in a separate (non-inlined)
+ * function if the placement matters. On targets without such a control
+ * register the object does nothing.
+ */
+class denormal_mode
+{
+#if _GLIBCXX_SIMD_HAVE_SSE
+  static constexpr unsigned _S_ftz = 0x8000;
+  static constexpr unsigned _S_daz = 0x0040;
+#elif defined __aarch64__ || (defined __arm__ && defined __ARM_FP)
+  static constexpr unsigned _S_ftz = 1u << 24;
+  static constexpr unsigned _S_daz = 0;
+#else
+  static constexpr unsigned _S_ftz = 0;
+  static constexpr unsigned _S_daz = 0;
+#endif
+  static constexpr unsigned _S_mask = _S_ftz | _S_daz;
+
+  unsigned _M_saved;
+
+  _GLIBCXX_SIMD_INTRINSIC static unsigned __get()
+  {
+#if _GLIBCXX_SIMD_HAVE_SSE
+    return _mm_getcsr();
+#elif defined __aarch64__
+    return __builtin_aarch64_get_fpcr();
+#elif defined __arm__ && defined __ARM_FP
+    return __builtin_arm_get_fpscr();
+#else
+    return 0;
+#endif
+  }
+
+  _GLIBCXX_SIMD_INTRINSIC static void __set([[maybe_unused]] unsigned __mode)
+  {
+#if _GLIBCXX_SIMD_HAVE_SSE
+    _mm_setcsr(__mode);
+#elif defined __aarch64__
+    __builtin_aarch64_set_fpcr(__mode);
+#elif defined __arm__ && defined __ARM_FP
+    __builtin_arm_set_fpscr(__mode);
+#endif
+  }
+
+public:
+  _GLIBCXX_SIMD_INTRINSIC explicit denormal_mode(
+    bool __flush_to_zero = true, bool __denormals_are_zero = true)
+  {
+    const unsigned __old = __get();
+    const unsigned __mode =
+      (__old & ~_S_mask) | (__flush_to_zero ? _S_ftz : 0u) |
+      (__denormals_are_zero ? _S_daz : 0u);
+    _M_saved = __old & _S_mask;
+    if (__mode != __old)
+      __set(__mode);
+  }
 
-_GLIBCXX_SIMD_MATH_CALL_(sqrt)
-_GLIBCXX_SIMD_MATH_CALL_(erf)
-_GLIBCXX_SIMD_MATH_CALL_(erfc)
-_GLIBCXX_SIMD_MATH_CALL_(lgamma)
-_GLIBCXX_SIMD_MATH_CALL_(tgamma)
-_GLIBCXX_SIMD_MATH_CALL_(ceil)
-_GLIBCXX_SIMD_MATH_CALL_(floor)
-_GLIBCXX_SIMD_MATH_CALL_(nearbyint)
-_GLIBCXX_SIMD_MATH_CALL_(rint)
-_GLIBCXX_SIMD_MATH_CALL_(lrint)
-_GLIBCXX_SIMD_MATH_CALL_(llrint)
+  denormal_mode(const denormal_mode&) = delete;
+  denormal_mode& operator=(const denormal_mode&) = delete;
 
-_GLIBCXX_SIMD_MATH_CALL_(round)
-_GLIBCXX_SIMD_MATH_CALL_(lround)
-_GLIBCXX_SIMD_MATH_CALL_(llround)
+  // restores only the denormal bits; exception flags raised in the meantime
+  // stay set
+  _GLIBCXX_SIMD_INTRINSIC ~denormal_mode()
+  {
+    const unsigned __cur = __get();
+    if ((__cur & _S_mask) != _M_saved)
+      __set((__cur & ~_S_mask) | _M_saved);
+  }
+};
+} // namespace __proposed
 
-_GLIBCXX_SIMD_MATH_CALL_(trunc)
+// }}}
 
-_GLIBCXX_SIMD_MATH_CALL2_(fmod, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(remainder, _Tp)
-_GLIBCXX_SIMD_MATH_CALL3_(remquo, _Tp, int *)
-template <typename _Tp, typename _Abi>
-enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
-  copysign(const simd<_Tp, _Abi>& __x, const simd<_Tp, _Abi>& __y)
+// }}}
+
+// special math {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>> assoc_laguerre(
+    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__n,
+    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__m,
+    const std::experimental::simd<_Tp, _Abi> &__x)
 {
-  using namespace std::experimental::__proposed::float_bitwise_operators;
-  const auto __signmask = -simd<_Tp, _Abi>();
-  return (__x & (__x ^ __signmask)) | (__y & __signmask);
+    return std::experimental::simd<_Tp, _Abi>([&](auto __i) { return std::assoc_laguerre(__n[__i], __m[__i], __x[__i]); });
 }
 
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>> assoc_legendre(
+    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__n,
+    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__m,
+    const std::experimental::simd<_Tp, _Abi> &__x)
+{
+    return std::experimental::simd<_Tp, _Abi>([&](auto __i) { return std::assoc_legendre(__n[__i], __m[__i], __x[__i]); });
+}
 
-_GLIBCXX_SIMD_MATH_CALL2_(nextafter, _Tp)
-// not covered in [parallel.simd.math]:
-// _GLIBCXX_SIMD_MATH_CALL2_(nexttoward, long double)
-_GLIBCXX_SIMD_MATH_CALL2_(fdim, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(fmax, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(fmin, _Tp)
-
-_GLIBCXX_SIMD_MATH_CALL3_(fma, _Tp, _Tp)
-_GLIBCXX_SIMD_MATH_CALL_(fpclassify)
-_GLIBCXX_SIMD_MATH_CALL_(isfinite)
+// Bessel functions {{{
+/*
+ * algorithm for cyl_bessel_j and cyl_bessel_i with ν = 0 and ν = 1:
+ *
+ * float is calculated in double. All polynomials are Chebyshev
+ * interpolations, converted to monomials. The scalar ABI uses the same
+ * implementation, since it is considerably more accurate than the scalar
+ * special functions (and faster).
+ *
+ * J_ν for x < 8 uses three intervals per order. The first is a polynomial in
+ * z = x² (times x for J₁). The other two factor out the zero j of J_ν inside
+ * the interval, J_ν(x) = (x - j_hi - j_lo) r(x - c), which keeps the relative
+ * error small close to the zero (x - j_hi is exact):
+ *   J₀: [0, 2), [2, 4) around j₀₁ = 2.40…, [4, 8) around j₀₂ = 5.52…
+ *   J₁: [0, 2), [2, 5) around j₁₁ = 3.83…, [5, 8) around j₁₂ = 7.01…
+ * For x >= 8 the Hankel expansion with w = 64/x² applies:
+ *   J₀(x) = ((P₀ + Q₀) cos(x) + (P₀ - Q₀) sin(x)) / √(πx)
+ *   J₁(x) = ((P₁ + Q₁) sin(x) + (Q₁ - P₁) cos(x)) / √(πx)
+ * with polynomials P(w) and x Q(w). sin(x) and cos(x) share one argument
+ * reduction. Close to the zeros beyond 8 the error is small relative to the
+ * envelope √(2/(πx)), but not relative to the result.
+ *
+ * I_ν for x < 8 is a polynomial in z = x² (times x for I₁). Above,
+ *   I_ν(x) = e^(x/2) (e^(x/2) s(8/x) / √x),  s(t) = I_ν(x) √x e^-x,
+ * which overflows only if the result does.
+ *
+ * Each interval is only evaluated if any element needs it. Other orders,
+ * negative x (a domain error), x >= 2^30 for J_ν (where __fold_input loses
+ * precision), and x > 1000 for I_ν (where the result overflows or the scalar
+ * function throws) make the whole call fall back to the scalar
+ * implementation.
+ */
+namespace __math_double
+{
+inline constexpr double __1_over_sqrt_pi = 0x1.20dd750429b6dp-1; // 1/√π
+}
+// __hankel_jn {{{
+/**\internal
+ * Returns J_\p _Nu(\p __x) for x >= 8. See above.
+ */
+template <int _Nu, class _Abi>
+simd<double, _Abi> __hankel_jn(const simd<double, _Abi>& __x)
+{
+  using _V = simd<double, _Abi>;
+  const _V __w = 64 / (__x * __x);
+  _V       __p, __q;
+  if constexpr (_Nu == 0)
+    {
+      __p = -0x1.c069f736b6d07p-33;
+      __p = __p * __w + 0x1.9574ab83359bap-30;
+      __p = __p * __w - 0x1.5e2a2ba53cb6fp-28;
+      __p = __p * __w + 0x1.9354193ca6e9dp-27;
+      __p = __p * __w - 0x1.7d68fe7dc52c1p-26;
+      __p = __p * __w + 0x1.6d7848fb5e27bp-25;
+      __p = __p * __w - 0x1.b65442e13598cp-24;
+      __p = __p * __w + 0x1.84ab2bdf28248p-22;
+      __p = __p * __w - 0x1.251eafdb745c5p-19;
+      __p = __p * __w + 0x1.cb5fffa33ef62p-16;
+      __p = __p * __w - 0x1.1ffffffff85e4p-10;
+      __p = __p * __w + 1;
+      __q = 0x1.b76054af4a257p-31;
+      __q = __q * __w - 0x1.b1cf35e6ec9edp-28;
+      __q = __q * __w + 0x1.8fa90e64b66c8p-26;
+      __q = __q * __w - 0x1.d08aee6f0ea66p-25;
+      __q = __q * __w + 0x1.8afcde2b151dep-24;
+      __q = __q * __w - 0x1.160c156e3512ap-23;
+      __q = __q * __w + 0x1.755c789453193p-23;
+      __q = __q * __w - 0x1.19413d165b45p-22;
+      __q = __q * __w + 0x1.13523bc3f35e2p-21;
+      __q = __q * __w - 0x1.8611859d3f363p-20;
+      __q = __q * __w + 0x1.ba4c423935486p-18;
+      __q = __q * __w - 0x1.d11dffe3e7222p-15;
+      __q = __q * __w + 0x1.2bfffffffc9b3p-10;
+      __q = __q * __w - 0x1.fffffffffffffp-4;
+    }
+  else
+    {
+      __p = 0x1.dde5ddec289d5p-33;
+      __p = __p * __w - 0x1.b08a31265358ap-30;
+      __p = __p * __w + 0x1.762c462f7fe5ep-28;
+      __p = __p * __w - 0x1.b04182e76da87p-27;
+      __p = __p * __w + 0x1.9afe8b011633bp-26;
+      __p = __p * __w - 0x1.8da65f7325101p-25;
+      __p = __p * __w + 0x1.e48c6af1501b1p-24;
+      __p = __p * __w - 0x1.b87f0af3a78f7p-22;
+      __p = __p * __w + 0x1.5a6a1c796bbe2p-19;
+      __p = __p * __w - 0x1.274fffced21f9p-15;
+      __p = __p * __w + 0x1.dffffffff7e8p-10;
+      __p = __p * __w + 1;
+      __q = -0x1.d03cbf509a9d8p-31;
+      __q = __q * __w + 0x1.ca91b871638a6p-28;
+      __q = __q * __w - 0x1.a6c4c8eb3e67ep-26;
+      __q = __q * __w + 0x1.ebf452fceffb2p-25;
+      __q = __q * __w - 0x1.a315ddb38f6aap-24;
+      __q = __q * __w + 0x1.27fb6b1e58c0bp-23;
+      __q = __q * __w - 0x1.8fb48276f7bb8p-23;
+      __q = __q * __w + 0x1.2fde7762676f2p-22;
+      __q = __q * __w - 0x1.2d8ea782b196dp-21;
+      __q = __q * __w + 0x1.b3f5ccdf4be6p-20;
+      __q = __q * __w - 0x1.fe57ffffe63e4p-18;
+      __q = __q * __w + 0x1.1c3cfff1360bep-14;
+      __q = __q * __w - 0x1.a3fffffffc6d6p-10;
+      __q = __q * __w + 0x1.8p-2;
+    }
+  __q /= __x;
+  const auto [__sin, __cos] = __proposed::sincos(__x);
+  _V __r;
+  if constexpr (_Nu == 0)
+    __r = (__p + __q) * __cos + (__p - __q) * __sin;
+  else
+    __r = (__p + __q) * __sin + (__q - __p) * __cos;
+  // √(πx) could overflow
+  return __r * (__math_double::__1_over_sqrt_pi / sqrt(__x));
+}
 
-// isnan and isinf require special treatment because old glibc may declare
-// `int std::isinf(double)`.
-template <class _Tp, class _Abi, class...,
-          class _R = std::experimental::__math_return_type_t<bool, _Tp, _Abi>>
-enable_if_t<std::is_floating_point_v<_Tp>, _R> isinf(
-    std::experimental::simd<_Tp, _Abi> __x)
+// }}}
+// __cyl_bessel_j0 {{{
+/**\internal
+ * Returns J₀(\p __x) for x >= 0 or NaN.
+ */
+template <class _Abi>
+simd<double, _Abi> __cyl_bessel_j0(const simd<double, _Abi>& __x)
 {
-  return {std::experimental::__private_init,
-          _Abi::_SimdImpl::__isinf(std::experimental::__data(__x))};
+  using _V = simd<double, _Abi>;
+  // the first two zeros of J₀, j = j_hi + j_lo
+  constexpr double __j01    = 0x1.33d152e971b4p+1;
+  constexpr double __j01_lo = -0x1.0f539d7da258ep-53;
+  constexpr double __j02    = 0x1.6148f5b2c2e45p+2;
+  constexpr double __j02_lo = 0x1.75054cd60a517p-54;
+  _V         __r   = __x; // NaN
+  const auto __in0 = __x < 2;
+  if (any_of(__in0))
+    {
+      const _V __z = __x * __x;
+      _V       __p;
+      __p = 0x1.46cb01ff34fabp-64;
+      __p = __p * __z - 0x1.0ae9745d9b603p-55;
+      __p = __p * __z + 0x1.5228c42ec936p-47;
+      __p = __p * __z - 0x1.522a3ef9b9f82p-39;
+      __p = __p * __z + 0x1.02e85bfdeeefcp-31;
+      __p = __p * __z - 0x1.234567898e81dp-24;
+      __p = __p * __z + 0x1.c71c71c71c0d6p-18;
+      __p = __p * __z - 0x1.c71c71c71c71p-12;
+      __p = __p * __z + 0x1p-6;
+      __p = __p * __z - 0x1p-2;
+      __p = __p * __z + 1;
+      where(__in0, __r) = __p;
+    }
+  const auto __in1 = __x >= 2 && __x < 4;
+  if (any_of(__in1))
+    {
+      const _V __t = __x - 3;
+      _V       __p;
+      __p = 0x1.3de5da973f2dfp-39;
+      __p = __p * __t - 0x1.524efc8d316f3p-37;
+      __p = __p * __t - 0x1.e93dee7ce0ae8p-32;
+      __p = __p * __t + 0x1.e71a61212713ap-30;
+      __p = __p * __t + 0x1.0fbc8b01e4bc7p-24;
+      __p = __p * __t - 0x1.f796015728f3ap-23;
+      __p = __p * __t - 0x1.a00dc270b4f4fp-18;
+      __p = __p * __t + 0x1.6519522b55a0ap-16;
+      __p = __p * __t + 0x1.915f2a76260e8p-12;
+      __p = __p * __t - 0x1.3d89bd607fd01p-10;
+      __p = __p * __t - 0x1.a2d3c6bcbc904p-7;
+      __p = __p * __t + 0x1.300593965a4c4p-5;
+      __p = __p * __t + 0x1.50c9f099730e6p-3;
+      __p = __p * __t - 0x1.bf6ba0f6116e5p-2;
+      where(__in1, __r) = ((__x - __j01) - __j01_lo) * __p;
+    }
+  const auto __in2 = __x >= 4 && __x < 8;
+  if (any_of(__in2))
+    {
+      const _V __t = __x - 6;
+      _V       __p;
+      __p = -0x1.bfb0b6915c2ap-56;
+      __p = __p * __t + 0x1.03d88a290bdf9p-52;
+      __p = __p * __t + 0x1.23d75c9bd056p-47;
+      __p = __p * __t - 0x1.3ecb0af8c157bp-44;
+      __p = __p * __t - 0x1.1e6ad2a71cf3bp-39;
+      __p = __p * __t + 0x1.246866f28c529p-36;
+      __p = __p * __t + 0x1.aab88a4a153f6p-32;
+      __p = __p * __t - 0x1.950feeadc7d5ap-29;
+      __p = __p * __t - 0x1.cd44e14cb2c7p-25;
+      __p = __p * __t + 0x1.949f158694f6fp-22;
+      __p = __p * __t + 0x1.52a757fbebd2dp-18;
+      __p = __p * __t - 0x1.104aed8457dep-15;
+      __p = __p * __t - 0x1.307fa1bf6f28fp-12;
+      __p = __p * __t + 0x1.bb360f4dabcebp-10;
+      __p = __p * __t + 0x1.15618767e6bd2p-7;
+      __p = __p * __t - 0x1.63c76276a6e61p-5;
+      __p = __p * __t - 0x1.3d97028754e56p-4;
+      __p = __p * __t + 0x1.416dc96e57c0ep-2;
+      where(__in2, __r) = ((__x - __j02) - __j02_lo) * __p;
+    }
+  const auto __large = __x >= 8;
+  if (any_of(__large))
+    where(__large, __r) = __hankel_jn<0>(max(__x, _V(8)));
+  return __r;
 }
-template <class _Tp, class _Abi, class...,
-          class _R = std::experimental::__math_return_type_t<bool, _Tp, _Abi>>
-enable_if_t<std::is_floating_point_v<_Tp>, _R> isnan(
-    std::experimental::simd<_Tp, _Abi> __x)
+
+// }}}
+// __cyl_bessel_j1 {{{
+/**\internal
+ * Returns J₁(\p __x) for x >= 0 or NaN.
+ */
+template <class _Abi>
+simd<double, _Abi> __cyl_bessel_j1(const simd<double, _Abi>& __x)
 {
-  return {std::experimental::__private_init,
-          _Abi::_SimdImpl::__isnan(std::experimental::__data(__x))};
+  using _V = simd<double, _Abi>;
+  // the first two zeros of J₁, j = j_hi + j_lo
+  constexpr double __j11    = 0x1.ea75575af6f09p+1;
+  constexpr double __j11_lo = -0x1.60155a9d1b256p-53;
+  constexpr double __j12    = 0x1.c0ff5f3b4725p+2;
+  constexpr double __j12_lo = -0x1.b226d9d243828p-54;
+  _V         __r   = __x; // NaN
+  const auto __in0 = __x < 2;
+  if (any_of(__in0))
+    {
+      const _V __z = __x * __x;
+      _V       __p;
+      __p = -0x1.987e233304c04p-60;
+      __p = __p * __z + 0x1.2c471d99040a3p-51;
+      __p = __p * __z - 0x1.5228cbbd491ecp-43;
+      __p = __p * __z + 0x1.27e4f74bdcc34p-35;
+      __p = __p * __z - 0x1.845c89fe3bc75p-28;
+      __p = __p * __z + 0x1.6c16c16bf75dap-21;
+      __p = __p * __z - 0x1.c71c71c71c249p-15;
+      __p = __p * __z + 0x1.555555555554fp-9;
+      __p = __p * __z - 0x1p-4;
+      __p = __p * __z + 0x1p-1;
+      where(__in0, __r) = __x * __p;
+    }
+  const auto __in1 = __x >= 2 && __x < 5;
+  if (any_of(__in1))
+    {
+      const _V __t = __x - 3.5;
+      _V       __p;
+      __p = -0x1.60b8d67ad42ddp-49;
+      __p = __p * __t + 0x1.3825215e8f0b8p-43;
+      __p = __p * __t + 0x1.5d74d5b7f30f9p-41;
+      __p = __p * __t - 0x1.19bd908ae87bfp-35;
+      __p = __p * __t - 0x1.fd77f316bdffep-34;
+      __p = __p * __t + 0x1.71e3017c43f4cp-28;
+      __p = __p * __t + 0x1.0baaed0e83c48p-26;
+      __p = __p * __t - 0x1.5a5020be22b68p-21;
+      __p = __p * __t - 0x1.7a72da390754ap-20;
+      __p = __p * __t + 0x1.af3e9808e877ap-15;
+      __p = __p * __t + 0x1.4286dc10cc508p-14;
+      __p = __p * __t - 0x1.403b1e384d511p-9;
+      __p = __p * __t - 0x1.0deff5c2f62acp-9;
+      __p = __p * __t + 0x1.d33c1f21037bcp-5;
+      __p = __p * __t + 0x1.0206deee1be97p-6;
+      __p = __p * __t - 0x1.a8181f74ef7b1p-2;
+      where(__in1, __r) = ((__x - __j11) - __j11_lo) * __p;
+    }
+  const auto __in2 = __x >= 5 && __x < 8;
+  if (any_of(__in2))
+    {
+      const _V __t = __x - 6.5;
+      _V       __p;
+      __p = -0x1.3d5e0c1110a43p-43;
+      __p = __p * __t - 0x1.18ff7617e80afp-43;
+      __p = __p * __t + 0x1.1bdb2afa9db52p-35;
+      __p = __p * __t + 0x1.23761db6a0ddbp-36;
+      __p = __p * __t - 0x1.70baeb702f296p-28;
+      __p = __p * __t - 0x1.bbc4759eaa355p-31;
+      __p = __p * __t + 0x1.53d2acc4e7a05p-21;
+      __p = __p * __t - 0x1.ec0655cdfdd14p-24;
+      __p = __p * __t - 0x1.9cbaeed49c647p-15;
+      __p = __p * __t + 0x1.7a11529dfe2c8p-16;
+      __p = __p * __t + 0x1.25bfadb126ff6p-9;
+      __p = __p * __t - 0x1.73a59e34c6171p-10;
+      __p = __p * __t - 0x1.8bedb81f6735ap-5;
+      __p = __p * __t + 0x1.d08a4092f3ae3p-6;
+      __p = __p * __t + 0x1.318ace8aae254p-2;
+      where(__in2, __r) = ((__x - __j12) - __j12_lo) * __p;
+    }
+  const auto __large = __x >= 8;
+  if (any_of(__large))
+    where(__large, __r) = __hankel_jn<1>(max(__x, _V(8)));
+  return __r;
 }
-_GLIBCXX_SIMD_MATH_CALL_(isnormal)
 
-template <class..., class _Tp, class _Abi>
-std::experimental::simd_mask<_Tp, _Abi>
-  signbit(std::experimental::simd<_Tp, _Abi> __x)
+// }}}
+// __cyl_bessel_in {{{
+/**\internal
+ * Returns I_\p _Nu(\p __x) for x in [0, 1000] or NaN. See above.
+ */
+template <int _Nu, class _Abi>
+simd<double, _Abi> __cyl_bessel_in(const simd<double, _Abi>& __x)
 {
-  if constexpr (std::is_integral_v<_Tp>)
+  using _V = simd<double, _Abi>;
+  _V         __r     = __x; // NaN
+  const auto __small = __x < 8;
+  if (any_of(__small))
     {
-      if constexpr (std::is_unsigned_v<_Tp>)
-	return std::experimental::simd_mask<_Tp, _Abi>{}; // false
+      const _V __z = __x * __x;
+      _V       __p;
+      if constexpr (_Nu == 0)
+	{
+	  __p = 0x1.294193ed7827p-110;
+	  __p = __p * __z + 0x1.05433b1b32442p-101;
+	  __p = __p * __z + 0x1.f72e4735e2d2fp-92;
+	  __p = __p * __z + 0x1.401b06c070f1fp-82;
+	  __p = __p * __z + 0x1.69fbf8016c6a9p-73;
+	  __p = __p * __z + 0x1.55fceae2f697ap-64;
+	  __p = __p * __z + 0x1.0b318351a4203p-55;
+	  __p = __p * __z + 0x1.522a3bdea4416p-47;
+	  __p = __p * __z + 0x1.522a448d1c138p-39;
+	  __p = __p * __z + 0x1.02e85c00c634fp-31;
+	  __p = __p * __z + 0x1.2345678a3b363p-24;
+	  __p = __p * __z + 0x1.c71c71c70ef94p-18;
+	  __p = __p * __z + 0x1.c71c71c71d358p-12;
+	  __p = __p * __z + 0x1.fffffffffff45p-7;
+	  __p = __p * __z + 0x1.0000000000004p-2;
+	  __p = __p * __z + 1;
+	}
       else
-	return __x < 0;
+	{
+	  __p = 0x1.20de50ee937a1p-115;
+	  __p = __p * __z + 0x1.1ec8e2d9b0ddbp-106;
+	  __p = __p * __z + 0x1.1dc3a22d140b1p-96;
+	  __p = __p * __z + 0x1.8a6faa072cdfap-87;
+	  __p = __p * __z + 0x1.e290ec0d14f98p-78;
+	  __p = __p * __z + 0x1.f17258b099a34p-69;
+	  __p = __p * __z + 0x1.ab8234c2c46fbp-60;
+	  __p = __p * __z + 0x1.2c97552280795p-51;
+	  __p = __p * __z + 0x1.522a443ba2a26p-43;
+	  __p = __p * __z + 0x1.27e4fb73f1ad7p-35;
+	  __p = __p * __z + 0x1.845c8a0d26f8p-28;
+	  __p = __p * __z + 0x1.6c16c16c13a93p-21;
+	  __p = __p * __z + 0x1.c71c71c71c9ecp-15;
+	  __p = __p * __z + 0x1.555555555554p-9;
+	  __p = __p * __z + 0x1.0000000000001p-4;
+	  __p = __p * __z + 0x1p-1;
+	  __p *= __x;
+	}
+      where(__small, __r) = __p;
     }
-  else
-    return {std::experimental::__private_init,
-	    _Abi::_SimdImpl::__signbit(std::experimental::__data(__x))};
+  const auto __large = __x >= 8;
+  if (any_of(__large))
+    {
+      const _V __xl = max(__x, _V(8));
+      const _V __t  = 8 / __xl;
+      _V       __s;
+      if constexpr (_Nu == 0)
+	{
+	  __s = -0x1.ada2c97f3fdddp-13;
+	  __s = __s * __t + 0x1.66e8e3430e1bep-9;
+	  __s = __s * __t - 0x1.131e8a75c71p-6;
+	  __s = __s * __t + 0x1.01711d545cedfp-4;
+	  __s = __s * __t - 0x1.49bf6b26afe43p-3;
+	  __s = __s * __t + 0x1.3311e67c5ca99p-2;
+	  __s = __s * __t - 0x1.af0b929606ad8p-2;
+	  __s = __s * __t + 0x1.d2905a59aaed3p-2;
+	  __s = __s * __t - 0x1.8b2a0d9fc19b3p-2;
+	  __s = __s * __t + 0x1.084b28a643c85p-2;
+	  __s = __s * __t - 0x1.18899a8c1ff1cp-3;
+	  __s = __s * __t + 0x1.d933166ce357ep-5;
+	  __s = __s * __t - 0x1.3c6a44a7c1403p-6;
+	  __s = __s * __t + 0x1.4d9c1db9285eap-8;
+	  __s = __s * __t - 0x1.12a3638e0f31bp-10;
+	  __s = __s * __t + 0x1.5c7642a88e8ebp-13;
+	  __s = __s * __t - 0x1.47797804658a5p-16;
+	  __s = __s * __t + 0x1.5e96982013a9dp-19;
+	  __s = __s * __t + 0x1.64a80d3cd551ap-19;
+	  __s = __s * __t + 0x1.6ead5772f893ap-17;
+	  __s = __s * __t + 0x1.debad42b0102p-15;
+	  __s = __s * __t + 0x1.cb94ddbf0140ap-12;
+	  __s = __s * __t + 0x1.9884533d4133bp-8;
+	  __s = __s * __t + 0x1.9884533d43651p-2;
+	}
+      else
+	{
+	  __s = 0x1.8a72ab2fc6959p-13;
+	  __s = __s * __t - 0x1.4fb110f69d6c3p-9;
+	  __s = __s * __t + 0x1.05118337f94f9p-6;
+	  __s = __s * __t - 0x1.ee4068a538e44p-5;
+	  __s = __s * __t + 0x1.3f827b276b64ep-3;
+	  __s = __s * __t - 0x1.2bd5859c6fc46p-2;
+	  __s = __s * __t + 0x1.a79590dc9ccd5p-2;
+	  __s = __s * __t - 0x1.ccf0b85f533a8p-2;
+	  __s = __s * __t + 0x1.88272f54d7775p-2;
+	  __s = __s * __t - 0x1.074557f1a3b54p-2;
+	  __s = __s * __t + 0x1.18582d2b239c5p-3;
+	  __s = __s * __t - 0x1.da2750869210cp-5;
+	  __s = __s * __t + 0x1.3dc7ff61dab68p-6;
+	  __s = __s * __t - 0x1.4fb436f4878cfp-8;
+	  __s = __s * __t + 0x1.14d11d2bdbd64p-10;
+	  __s = __s * __t - 0x1.5fc1b83696ebap-13;
+	  __s = __s * __t + 0x1.4a21c3b06e27p-16;
+	  __s = __s * __t - 0x1.7689c70fd7a22p-19;
+	  __s = __s * __t - 0x1.b6f2905fdef26p-19;
+	  __s = __s * __t - 0x1.d766c16b26f52p-17;
+	  __s = __s * __t - 0x1.4f1c6d2ea37p-14;
+	  __s = __s * __t - 0x1.7efc0e16a7adp-11;
+	  __s = __s * __t - 0x1.32633e6df1fd8p-6;
+	  __s = __s * __t + 0x1.9884533d4365p-2;
+	}
+      const _V __e = exp(.5 * __xl);
+      where(__large, __r) = __e * (__e * __s / sqrt(__xl));
+    }
+  return __r;
 }
 
-_GLIBCXX_SIMD_MATH_CALL2_(isgreater, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(isgreaterequal, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(isless, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(islessequal, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(islessgreater, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(isunordered, _Tp)
+// }}}
+// cyl_bessel_j {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  cyl_bessel_j(const simd<_Tp, _Abi>& __nu, const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__cyl_bessel_j(__data(__nu), __data(__x))};
+    }
+  else
+    {
+      const auto __one = __nu == 1;
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(
+	    !all_of((__nu == 0 || __one || isnan(__nu))
+		    && !(__x < 0 || __x >= _Tp(0x1p30)))))
+	return {__private_init,
+		_Abi::_SimdImpl::__cyl_bessel_j(__data(__nu), __data(__x))};
+      if constexpr (is_same_v<_Tp, float>)
+	{
+	  using _VD = rebind_simd_t<double, _V>;
+	  return static_simd_cast<_V>(cyl_bessel_j(static_simd_cast<_VD>(__nu),
+						   static_simd_cast<_VD>(__x)));
+	}
+      else
+	{
+	  _V __r;
+	  if (none_of(__one))
+	    __r = __cyl_bessel_j0(__x);
+	  else if (all_of(__one))
+	    __r = __cyl_bessel_j1(__x);
+	  else
+	    {
+	      __r = __cyl_bessel_j0(__x);
+	      where(__one, __r) = __cyl_bessel_j1(__x);
+	    }
+	  where(isnan(__nu), __r) = __nu;
+	  return __r;
+	}
+    }
+}
+_GLIBCXX_SIMD_CVTING2(cyl_bessel_j)
 
-/* not covered in [parallel.simd.math]
-template <class _Abi> __doublev<_Abi> nan(const char* tagp);
-template <class _Abi> __floatv<_Abi> nanf(const char* tagp);
-template <class _Abi> __ldoublev<_Abi> nanl(const char* tagp);
+// }}}
+// cyl_bessel_i {{{
+template <class _Tp, class _Abi>
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  cyl_bessel_i(const simd<_Tp, _Abi>& __nu, const simd<_Tp, _Abi>& __x)
+{
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    {
+      return {__private_init,
+	      _Abi::_SimdImpl::__cyl_bessel_i(__data(__nu), __data(__x))};
+    }
+  else
+    {
+      const auto __one = __nu == 1;
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(
+	    !all_of((__nu == 0 || __one || isnan(__nu))
+		    && !(__x < 0 || __x > 1000))))
+	return {__private_init,
+		_Abi::_SimdImpl::__cyl_bessel_i(__data(__nu), __data(__x))};
+      if constexpr (is_same_v<_Tp, float>)
+	{
+	  using _VD = rebind_simd_t<double, _V>;
+	  return static_simd_cast<_V>(cyl_bessel_i(static_simd_cast<_VD>(__nu),
+						   static_simd_cast<_VD>(__x)));
+	}
+      else
+	{
+	  _V __r;
+	  if (none_of(__one))
+	    __r = __cyl_bessel_in<0>(__x);
+	  else if (all_of(__one))
+	    __r = __cyl_bessel_in<1>(__x);
+	  else
+	    {
+	      __r = __cyl_bessel_in<0>(__x);
+	      where(__one, __r) = __cyl_bessel_in<1>(__x);
+	    }
+	  where(isnan(__nu), __r) = __nu;
+	  return __r;
+	}
+    }
+}
+_GLIBCXX_SIMD_CVTING2(cyl_bessel_i)
 
-template <class _V> struct simd_div_t {
-    _V quot, rem;
-};
-template <class _Abi>
-simd_div_t<_SCharv<_Abi>> div(_SCharv<_Abi> numer,
-                                         _SCharv<_Abi> denom);
-template <class _Abi>
-simd_div_t<__shortv<_Abi>> div(__shortv<_Abi> numer,
-                                         __shortv<_Abi> denom);
-template <class _Abi>
-simd_div_t<__intv<_Abi>> div(__intv<_Abi> numer, __intv<_Abi> denom);
+// }}}
+// }}}
+// complete elliptic integrals {{{
+/*
+ * algorithm for comp_ellint_1 and comp_ellint_2 (arithmetic-geometric mean):
+ *
+ * a₀ = 1, b₀ = √((1 - k)(1 + k)), c₀ = k
+ * a_n+1 = (a_n + b_n) / 2, b_n+1 = √(a_n b_n), c_n+1 = (a_n - b_n) / 2
+ * K(k) = π / (2 a_∞)
+ * E(k) = K(k) (1 - Σ 2^(n-1) c_n²)
+ *
+ * The mean converges quadratically. Once c_n <= 2^-27 a_n, the following
+ * terms are below double precision. For |k| < 1, b₀ >= 2^-26 and at most 8
+ * iterations are needed. float is calculated in double. As for
+ * the Bessel functions, the scalar ABI uses the same implementation.
+ *
+ * K(k) is NaN for |k| >= 1 (as for the scalar function), E(±1) = 1. E(k)
+ * for |k| > 1 is a domain error and falls back to the scalar
+ * implementation.
+ */
+// __agm_ellint {{{
+/**\internal
+ * Returns a_∞ in _M_a and Σ 2^(n-1) c_n² in _M_s for |\p __k| < 1. See
+ * above.
+ */
 template <class _Abi>
-simd_div_t<__longv<_Abi>> div(__longv<_Abi> numer,
-                                        __longv<_Abi> denom);
+struct __agm_result
+{
+  simd<double, _Abi> _M_a;
+  simd<double, _Abi> _M_s;
+};
+
 template <class _Abi>
-simd_div_t<__llongv<_Abi>> div(__llongv<_Abi> numer,
-                                         __llongv<_Abi> denom);
-*/
+__agm_result<_Abi> __agm_ellint(const simd<double, _Abi>& __k)
+{
+  using _V = simd<double, _Abi>;
+  __agm_result<_Abi> __r = {1, .5 * __k * __k};
+  _V __b = sqrt((1 - __k) * (1 + __k));
+  _V __w = 1;
+  // at most 8 iterations are needed (see above); the bound also stops NaN
+  // lanes
+  for (int __i = 0; __i < 8; ++__i)
+    {
+      const _V __c = .5 * (__r._M_a - __b);
+      __r._M_s += __w * __c * __c;
+      __w *= 2;
+      const _V __a = .5 * (__r._M_a + __b);
+      __b          = sqrt(__r._M_a * __b);
+      __r._M_a     = __a;
+      if (all_of(__c <= 0x1p-27 * __a))
+	break;
+    }
+  return __r;
+}
 
-// special math {{{
+// }}}
+// comp_ellint_1 {{{
 template <class _Tp, class _Abi>
-enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>> assoc_laguerre(
-    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__n,
-    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__m,
-    const std::experimental::simd<_Tp, _Abi> &__x)
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  comp_ellint_1(const simd<_Tp, _Abi>& __k)
 {
-    return std::experimental::simd<_Tp, _Abi>([&](auto __i) { return std::assoc_laguerre(__n[__i], __m[__i], __x[__i]); });
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    {
+      return {__private_init, _Abi::_SimdImpl::__comp_ellint_1(__data(__k))};
+    }
+  else if constexpr (is_same_v<_Tp, float>)
+    {
+      using _VD = rebind_simd_t<double, _V>;
+      return static_simd_cast<_V>(comp_ellint_1(static_simd_cast<_VD>(__k)));
+    }
+  else
+    {
+      const auto __inside = abs(__k) < 1;
+      _V         __kk     = __k;
+      where(!__inside, __kk) = 0;
+      _V __r = __math_double::__pi_2 / __agm_ellint(__kk)._M_a;
+      where(!__inside, __r) = std::numeric_limits<double>::quiet_NaN();
+      return __r;
+    }
 }
 
+// }}}
+// comp_ellint_2 {{{
 template <class _Tp, class _Abi>
-enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>> assoc_legendre(
-    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__n,
-    const std::experimental::fixed_size_simd<unsigned, std::experimental::simd_size_v<_Tp, _Abi>> &__m,
-    const std::experimental::simd<_Tp, _Abi> &__x)
+enable_if_t<std::is_floating_point_v<_Tp>, simd<_Tp, _Abi>>
+  comp_ellint_2(const simd<_Tp, _Abi>& __k)
 {
-    return std::experimental::simd<_Tp, _Abi>([&](auto __i) { return std::assoc_legendre(__n[__i], __m[__i], __x[__i]); });
+  using _V = simd<_Tp, _Abi>;
+  if constexpr (__is_fixed_size_abi_v<_Abi>)
+    {
+      return {__private_init, _Abi::_SimdImpl::__comp_ellint_2(__data(__k))};
+    }
+  else
+    {
+      if (_GLIBCXX_SIMD_IS_UNLIKELY(any_of(abs(__k) > 1)))
+	return {__private_init, _Abi::_SimdImpl::__comp_ellint_2(__data(__k))};
+      if constexpr (is_same_v<_Tp, float>)
+	{
+	  using _VD = rebind_simd_t<double, _V>;
+	  return static_simd_cast<_V>(
+	    comp_ellint_2(static_simd_cast<_VD>(__k)));
+	}
+      else
+	{
+	  const auto __inside = abs(__k) < 1;
+	  _V         __kk     = __k;
+	  where(!__inside, __kk) = 0;
+	  const auto __m = __agm_ellint(__kk);
+	  _V __r = __math_double::__pi_2 * (1 - __m._M_s) / __m._M_a;
+	  where(!__inside, __r) = 1;
+	  where(isnan(__k), __r) = __k;
+	  return __r;
+	}
+    }
 }
 
+// }}}
+// }}}
+
 _GLIBCXX_SIMD_MATH_CALL2_(beta, _Tp)
-_GLIBCXX_SIMD_MATH_CALL_(comp_ellint_1)
-_GLIBCXX_SIMD_MATH_CALL_(comp_ellint_2)
 _GLIBCXX_SIMD_MATH_CALL2_(comp_ellint_3, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(cyl_bessel_i, _Tp)
-_GLIBCXX_SIMD_MATH_CALL2_(cyl_bessel_j, _Tp)
 _GLIBCXX_SIMD_MATH_CALL2_(cyl_bessel_k, _Tp)
 _GLIBCXX_SIMD_MATH_CALL2_(cyl_neumann, _Tp)
 _GLIBCXX_SIMD_MATH_CALL2_(ellint_1, _Tp)
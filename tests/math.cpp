@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "metahelpers.h"
 #include <cmath>    // abs & sqrt
 #include <cstdlib>  // integer abs
+#include <cfenv>
 #include "mathreference.h"
 #include "simd_view.h"
 #include "test_values.h"
@@ -101,7 +102,8 @@ TEST_TYPES(V, fpclassify, real_test_types)  //{{{1
         {0., -0., 1., -1., limits::infinity(), -limits::infinity(), limits::max(),
          -limits::max(), limits::min(), limits::min() * 0.9, -limits::min(),
          -limits::min() * 0.9, limits::denorm_min(), -limits::denorm_min(),
-         limits::quiet_NaN(), limits::signaling_NaN()},
+         limits::quiet_NaN(), limits::signaling_NaN(), -limits::quiet_NaN(),
+         -limits::signaling_NaN()},
         [](const V input) {
             using intv = std::experimental::fixed_size_simd<int, V::size()>;
             COMPARE(isfinite(input), !V([&](auto i) { return std::isfinite(input[i]) ? 0 : 1; })) << input;
@@ -295,6 +297,51 @@ TEST_TYPES(V, cos, real_test_types)  //{{{1
         });
 }
 
+TEST_TYPES(V, sincos, real_test_types)  //{{{1
+{
+    using std::experimental::__proposed::sincos;
+    using T = typename V::value_type;
+
+    vir::test::setFuzzyness<float>(2);
+    vir::test::setFuzzyness<double>(1);
+
+    const auto &testdata = referenceData<function::sincos, T>();
+    std::experimental::experimental::simd_view<V>(testdata).for_each(
+        [&](const V input, const V expected_sin, const V expected_cos) {
+            const auto r = sincos(input);
+            FUZZY_COMPARE(r.first, expected_sin) << " input = " << input;
+            FUZZY_COMPARE(r.second, expected_cos) << " input = " << input;
+            const auto r2 = sincos(-input);
+            FUZZY_COMPARE(r2.first, -expected_sin) << " input = " << input;
+            FUZZY_COMPARE(r2.second, expected_cos) << " input = " << input;
+        });
+
+    // special values and the large argument reductions; like sin and cos, the
+    // range reduction is only precise for |x| < 2^30. The directed rounding
+    // modes cost some ulp for large arguments.
+    vir::test::setFuzzyness<float>(3);
+    vir::test::setFuzzyness<double>(3);
+    const auto sincos_sin = [](const V &x) { return sincos(x).first; };
+    const auto sincos_cos = [](const V &x) { return sincos(x).second; };
+    using limits = std::numeric_limits<T>;
+    test_values<V>(
+        {limits::quiet_NaN(), limits::infinity(), -limits::infinity(), +0., -0.,
+         limits::min(), 393382, -393382, 527449, -527449, 0x1p30, -0x1p30},
+        {10000, -0x1p30, 0x1p30}, MAKE_TESTER_2(sincos_sin, std::sin),
+        MAKE_TESTER_2(sincos_cos, std::cos));
+
+    // float reduces in float lanes below 2^23 and converts to double above
+    vir::test::setFuzzyness<float>(4);
+    test_values<V>({0x1.fffffep22, -0x1.fffffep22, 0x1p23, -0x1p23, 65536, -65536},
+                   {10000, -0x1p23, 0x1p23}, MAKE_TESTER_2(sincos_sin, std::sin),
+                   MAKE_TESTER_2(sincos_cos, std::cos), MAKE_TESTER(sin),
+                   MAKE_TESTER(cos));
+    vir::test::setFuzzyness<float>(6);
+    vir::test::setFuzzyness<double>(6);
+    test_values<V>({0x1.fffffep22, -0x1.fffffep22, 0x1p23, -0x1p23},
+                   {10000, -0x1p23, 0x1p23}, MAKE_TESTER(tan));
+}
+
 TEST_TYPES(V, asin, real_test_types)  //{{{1
 {
     using std::asin;
@@ -442,6 +489,41 @@ TEST_TYPES(V, trig, real_test_types)  //{{{1
         MAKE_TESTER(sinh),
         MAKE_TESTER(tanh)
         );
+
+    // close to the poles the directed rounding modes cost some ulp in the
+    // reduced argument
+    if (std::fegetround() == FE_TONEAREST) {
+        vir::test::setFuzzyness<float>(3);
+        vir::test::setFuzzyness<double>(2);
+    } else {
+        vir::test::setFuzzyness<float>(6);
+        vir::test::setFuzzyness<double>(7);
+    }
+    test_values<V>({0.5, -0.5, 1, -1, 0x1.921fb6p-1, -0x1.921fb6p-1, 0x1.921fb4p0,
+                    -0x1.921fb4p0, 0x1.921fb6p0, -0x1.921fb6p0, 0x1p-30, -0x1p-30},
+                   {10000, -1000, 1000}, MAKE_TESTER(tan));
+
+    // finite results from the polynomial and the exponential branches
+    vir::test::setFuzzyness<float>(3);
+    vir::test::setFuzzyness<double>(3);
+    test_values<V>({0.5, -0.5, 0.625, -0.625, 1, -1, 20, -20, 80, -80, 0x1p-30,
+                    -0x1p-30},
+                   {10000, -20, 20}, MAKE_TESTER(sinh), MAKE_TESTER(cosh),
+                   MAKE_TESTER(tanh));
+
+    // log1p and log branches of the inverse hyperbolic functions
+    test_values<V>({0.5, -0.5, 0.25, -0.25, 1, -1, 2, -2, 1.0625, 1e10, -1e10,
+                    0x1p-30, -0x1p-30},
+                   {10000, -4, 4}, MAKE_TESTER(asinh), MAKE_TESTER(acosh),
+                   MAKE_TESTER(atanh));
+
+    vir::test::setFuzzyness<float>(2);
+    vir::test::setFuzzyness<double>(2);
+    test_values<V>({0.5, -0.5, 1, -1, 0.66, -0.66, 0x1.3504f333f9de6p1,
+                    -0x1.3504f333f9de6p1},
+                   {10000, -1, 1}, MAKE_TESTER(asin), MAKE_TESTER(acos),
+                   MAKE_TESTER(atan));
+    test_values<V>({100, -100}, {10000, -100, 100}, MAKE_TESTER(atan));
 }
 
 TEST_TYPES(V, logarithms, real_test_types)  //{{{1
@@ -463,6 +545,16 @@ TEST_TYPES(V, logarithms, real_test_types)  //{{{1
         MAKE_TESTER(log2),
         MAKE_TESTER(logb)
         );
+
+    // inputs close to 1, where the polynomial dominates the result
+    vir::test::setFuzzyness<float>(3);
+    vir::test::setFuzzyness<double>(3);
+    test_values<V>({0.5, 0.75, 1.25, 1.5, 0x1.6a09e6p-1, 0x1.6a09e8p-1, 0x1.fffffep-1,
+                    0x1.000002p0},
+                   {10000, 0.5, 2}, MAKE_TESTER(log), MAKE_TESTER(log10),
+                   MAKE_TESTER(log2));
+    test_values<V>({0.5, -0.5, 0x1p-30, -0x1p-30, 0x1p-100, -0x1p-100},
+                   {10000, -0.5, 1}, MAKE_TESTER(log1p));
 }
 
 TEST_TYPES(V, exponentials, real_test_types)  //{{{1
@@ -479,6 +571,285 @@ TEST_TYPES(V, exponentials, real_test_types)  //{{{1
         MAKE_TESTER(exp2),
         MAKE_TESTER(expm1)
         );
+
+    // inputs with finite, non-zero results
+    test_values<V>({1, -1, 2, -2, 0.5, -0.5, 10, -10, 80, -80, 0x1p-20, -0x1p-20},
+                   {10000, -80, 80}, MAKE_TESTER(exp), MAKE_TESTER(exp2));
+
+    // e^x - 1 cancels for x ∈ [½ln2, ln2], which costs some ulp in the
+    // directed rounding modes
+    vir::test::setFuzzyness<float>(4);
+    vir::test::setFuzzyness<double>(3);
+    test_values<V>({0.35, -0.35, 0.7, -0.7, 0x1p-20, -0x1p-20, 0x1p-100, -0x1p-100},
+                   {10000, -1, 1}, MAKE_TESTER(expm1));
+}
+
+TEST_TYPES(V, fast_math, real_test_types)  //{{{1
+{
+    // __proposed::fast_math only promises its accuracy inside a restricted domain
+    // and when rounding to nearest
+    namespace fast = std::experimental::__proposed::fast_math;
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    constexpr bool is_float = std::is_same_v<T, float>;
+    constexpr T sin_max = is_float ? 8192 : 0x1p30;
+    constexpr T exp_max = is_float ? 87 : 708;
+
+    // the absolute error is bounded, not the relative error
+    test_values<V>({0, 1, -1, 0x1.921fb6p0, -0x1.921fb6p0, 0x1.921fb6p1, -0x1.921fb6p1,
+                    100, -100, sin_max, -sin_max, 0x1p-30, -0x1p-30},
+                   {10000, -sin_max, sin_max}, [](const V &x) {
+                       const V s = to_nearest([&]() { return fast::sin(x); });
+                       const V c = to_nearest([&]() { return fast::cos(x); });
+                       const V s_ref = to_nearest(
+                           [&]() { return V([&](auto i) { return std::sin(x[i]); }); });
+                       const V c_ref = to_nearest(
+                           [&]() { return V([&](auto i) { return std::cos(x[i]); }); });
+                       VERIFY(all_of(abs(s - s_ref) <= 2 * limits::epsilon()))
+                           << "x = " << x << ", sin = " << s << " vs " << s_ref;
+                       VERIFY(all_of(abs(c - c_ref) <= 2 * limits::epsilon()))
+                           << "x = " << x << ", cos = " << c << " vs " << c_ref;
+                   });
+
+    vir::test::setFuzzyness<float>(2);
+    vir::test::setFuzzyness<double>(2);
+    test_values<V>({0, 1, -1, 0.5, -0.5, 10, -10, exp_max, -exp_max, 0x1p-30, -0x1p-30},
+                   {10000, -exp_max, exp_max}, [](const V &x) {
+                       FUZZY_COMPARE(to_nearest([&]() { return fast::exp(x); }),
+                                     to_nearest([&]() {
+                                         return V([&](auto i) { return std::exp(x[i]); });
+                                     }))
+                           << "x = " << x;
+                   });
+
+    vir::test::setFuzzyness<float>(3);
+    vir::test::setFuzzyness<double>(2);
+    const auto test_log = [](V x) {
+        where(x == 0, x) = 1;  // epilogue_load pads with zeros
+        FUZZY_COMPARE(to_nearest([&]() { return fast::log(x); }), to_nearest([&]() {
+                          return V([&](auto i) { return std::log(x[i]); });
+                      }))
+            << "x = " << x;
+    };
+    test_values<V>({1, 2, 0.5, 3, 0x1.6a09e6p-1, 0x1.6a09e8p-1, 0x1.fffffep-1, 0x1.000002p0,
+                    limits::denorm_min(), limits::min(), limits::max()},
+                   {10000, 0.5, 2}, test_log);
+    test_values<V>({limits::max() / 3}, {10000, limits::min(), limits::max()}, test_log);
+
+    // the error of pow grows with |y·ln x|
+    test_values<V>({0.5, 2, 3, 10, 0x1.6a09e6p-1, 100}, {10000, 0.125, 100}, [](V x) {
+        where(x == 0, x) = 2;  // epilogue_load pads with zeros (and log(1) = 0 below)
+        for (T t : {T(0.5), T(-1), T(5), T(-20), T(80)}) {
+            const V y = t / to_nearest([&]() { return V([&](auto i) { return std::log(x[i]); }); });
+            const V totest = to_nearest([&]() { return fast::pow(x, y); });
+            const V expect =
+                to_nearest([&]() { return V([&](auto i) { return std::pow(x[i], y[i]); }); });
+            VERIFY(all_of(abs(totest - expect) <= 2 * (2 + abs(t)) * limits::epsilon() * expect))
+                << "x = " << x << ", y = " << y << ", pow = " << totest << " vs " << expect;
+        }
+    });
+}
+
+TEST_TYPES(V, rcp_rsqrt, real_test_types)  //{{{1
+{
+    using std::experimental::__proposed::rcp;
+    using std::experimental::__proposed::rsqrt;
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+
+    vir::test::setFuzzyness<float>(4);
+    vir::test::setFuzzyness<double>(4);
+    // rcp is only specified for a normal 1/x
+    test_values<V>({1, -1, 2, -2, 3, -3, 0x1.fffffep0, 0x1.000002p0, 100, -100,
+                    limits::min() * 4, -limits::min() * 4, limits::max() / 4,
+                    -limits::max() / 4},
+                   {10000, -limits::max() / 4, limits::max() / 4}, [](V x) {
+                       where(x == 0, x) = 1;  // epilogue_load pads with zeros
+                       FUZZY_COMPARE(rcp(x), V([&](auto i) { return 1 / x[i]; }))
+                           << "x = " << x;
+                       // the bare estimate is good to 11 bits
+                       VERIFY(all_of(abs(rcp<0>(x) * x - 1) <= T(0x1.8p-12)))
+                           << "x = " << x << ", rcp<0> = " << rcp<0>(x);
+                   });
+    test_values<V>({1, 2, 3, 4, 0x1.fffffep0, 0x1.000002p0, 100, limits::min(),
+                    limits::max()},
+                   {10000, limits::min(), limits::max()}, [](V x) {
+                       where(x == 0, x) = 1;
+                       FUZZY_COMPARE(rsqrt(x), V([&](auto i) {
+                                         return T(1 / std::sqrt((long double)x[i]));
+                                     }))
+                           << "x = " << x;
+                       VERIFY(all_of(abs(rsqrt<0>(x) * rsqrt<0>(x) * x - 1) <=
+                                     T(0x1.8p-11)))
+                           << "x = " << x << ", rsqrt<0> = " << rsqrt<0>(x);
+                   });
+}
+
+TEST_TYPES(V, polynomial, real_test_types)  //{{{1
+{
+    using namespace std::experimental::__proposed;
+    using T = typename V::value_type;
+
+    // small integers keep every intermediate exact
+    const V i([](auto j) { return T(int(j) % 4 - 2); });
+    const V expected([](auto j) {
+        const T x = int(j) % 4 - 2;
+        return 1 + x * (2 + x * (-3 + x * (4 + x * (5 + x * (-6 + x * (7 + x * 8))))));
+    });
+    COMPARE(polynomial<horner>(i, 1, 2, -3, 4, 5, -6, 7, 8), expected);
+    COMPARE(polynomial<estrin>(i, 1, 2, -3, 4, 5, -6, 7, 8), expected);
+    COMPARE(polynomial<estrin>(i, 1, 2, -3, 4, 5), V([](auto j) {
+                const T x = int(j) % 4 - 2;
+                return 1 + x * (2 + x * (-3 + x * (4 + x * 5)));
+            }));
+    COMPARE(polynomial<estrin>(i, 1.5), V(T(1.5)));
+    COMPARE(polynomial(i, 0, 1), i);
+
+    // the 10-term Taylor series of exp(x); the alternating terms for x < 0
+    // cost an ulp of cancellation without fma
+    vir::test::setFuzzyness<float>(3);
+    vir::test::setFuzzyness<double>(3);
+    test_values<V>({0, 1, -1, T(0.5), T(-0.5)}, {10000, -1, 1}, [](V x) {
+        const V reference([&](auto j) {
+            long double r = 0;
+            for (int k = 9; k >= 0; --k) {
+                r = r * x[j] + T(1 / std::tgamma(k + 1.L));
+            }
+            return T(r);
+        });
+        FUZZY_COMPARE(polynomial<horner>(x, 1, 1, .5, 1 / 6., 1 / 24., 1 / 120., 1 / 720.,
+                                         1 / 5040., 1 / 40320., 1 / 362880.),
+                      reference)
+            << "x = " << x;
+        FUZZY_COMPARE(polynomial<estrin>(x, 1, 1, .5, 1 / 6., 1 / 24., 1 / 120., 1 / 720.,
+                                         1 / 5040., 1 / 40320., 1 / 362880.),
+                      reference)
+            << "x = " << x;
+    });
+}
+
+TEST_TYPES(V, cube_root, real_test_types)  //{{{1
+{
+    // glibc's cbrt itself deviates by up to 3.5 ulp (double)
+    vir::test::setFuzzyness<float>(1);
+    vir::test::setFuzzyness<double>(3);
+
+    using limits = std::numeric_limits<typename V::value_type>;
+    test_values<V>(
+        {limits::quiet_NaN(), limits::infinity(), -limits::infinity(), +0., -0.,
+         limits::denorm_min(), limits::min(), limits::max(), limits::min() / 3,
+         -limits::denorm_min(), -limits::min(), -limits::max(), -limits::min() / 3,
+         1, -1, 2, 4, 8, 27, -27, 0.125},
+        {10000, -limits::max() / 2, limits::max() / 2}, MAKE_TESTER(cbrt));
+    test_values<V>({0.5, 0x1.6a09e6p-1, 0x1.6a09e8p-1, 0x1.fffffep0}, {10000, -10, 10},
+                   MAKE_TESTER(cbrt));
+}
+
+TEST_TYPES(V, error_functions, real_test_types)  //{{{1
+{
+    vir::test::setFuzzyness<float>(0);
+    vir::test::setFuzzyness<double>(0);
+
+    using limits = std::numeric_limits<typename V::value_type>;
+    test_values<V>({limits::quiet_NaN(), limits::infinity(), -limits::infinity(), +0., -0.},
+                   MAKE_TESTER(erf), MAKE_TESTER(erfc));
+    // == can't tell the zeros apart
+    VERIFY(none_of(signbit(erf(V()))));
+    VERIFY(all_of(signbit(erf(-V()))));
+
+    vir::test::setFuzzyness<float>(1);
+    vir::test::setFuzzyness<double>(1);
+    test_values<V>(
+        {limits::denorm_min(), limits::min(), limits::max(), limits::min() / 3,
+         -limits::denorm_min(), -limits::min(), -limits::max(), 0x1p-30, -0x1p-30},
+        {10000, -limits::max() / 2, limits::max() / 2}, MAKE_TESTER(erf),
+        MAKE_TESTER(erfc));
+
+    // all intervals of the piecewise approximation
+    test_values<V>({0.25, -0.25, 0.84375, -0.84375, 1, -1, 1.25, -1.25, 2.857, -2.857,
+                    5.9, -5.9},
+                   {10000, -7, 7}, MAKE_TESTER(erf));
+
+    // erfc loses some ulp in [0.84375, 1.25) and via exp otherwise; glibc's
+    // erfc itself deviates by up to 3.5 ulp (double)
+    vir::test::setFuzzyness<float>(3);
+    vir::test::setFuzzyness<double>(5);
+    test_values<V>({0.25, -0.25, 0.84375, -0.84375, 1, -1, 1.25, -1.25, 2.857, -2.857,
+                    9, 10, 26, 27, -7},
+                   {10000, -7, 28}, MAKE_TESTER(erfc));
+}
+
+TEST_TYPES(V, gamma_functions, real_test_types)  //{{{1
+{
+    using T = typename V::value_type;
+    using L = long double;
+    using limits = std::numeric_limits<T>;
+    vir::test::setFuzzyness<float>(0);
+    vir::test::setFuzzyness<double>(0);
+    test_values<V>({limits::quiet_NaN(), limits::infinity(), -limits::infinity(), +0., -0., 1,
+                    2, -1, -2, -3, -12, -13, -14, -100, -limits::max()},
+                   MAKE_TESTER(lgamma), MAKE_TESTER(tgamma));
+    // == can't tell the zeros apart
+    VERIFY(none_of(signbit(lgamma(V(1)))));
+    VERIFY(none_of(signbit(lgamma(V(2)))));
+
+    // scalar and fixed_size (at least in part) call glibc, which is less accurate
+    // than the vectorized implementation and not exact for tgammaf(n)
+    constexpr bool vectorized
+        = !std::is_same_v<typename V::abi_type, std::experimental::simd_abi::scalar>
+          && !std::is_same_v<typename V::abi_type,
+                             std::experimental::simd_abi::fixed_size<V::size()>>;
+    if constexpr (vectorized) {
+        T factorial = 1;
+        for (int n = 1; n <= 12; factorial *= n, ++n) {
+            COMPARE(tgamma(V(T(n))), V(factorial)) << "n = " << n;
+        }
+    }
+
+    const bool nearest = std::fegetround() == FE_TONEAREST;
+    const auto lgamma_ref = [](T x) { return T(std::lgamma(L(x))); };
+    const auto tgamma_ref = [](T x) { return T(std::tgamma(L(x))); };
+    // float is computed in double; glibc deviates by up to 6 (float) and 7 (double)
+    // ulp in every rounding mode
+    const auto double_ulp = [nearest](int when_nearest, int when_directed) {
+        return !vectorized ? 7 : nearest ? when_nearest : when_directed;
+    };
+    vir::test::setFuzzyness<float>(vectorized ? 1 : 6);
+    vir::test::setFuzzyness<double>(double_ulp(4, 6));
+    test_values<V>({limits::denorm_min(), limits::min(), limits::min() / 3, 0x1p-30, 0.5,
+                    1.25, 1.5, 2.5, 3, 12.5, 13, limits::max()},
+                   {10000, 0, 13}, MAKE_TESTER_2(lgamma, lgamma_ref));
+    vir::test::setFuzzyness<double>(double_ulp(2, 4));
+    test_values<V>({100, 1e10}, {10000, 13, 1e6}, MAKE_TESTER_2(lgamma, lgamma_ref));
+    vir::test::setFuzzyness<double>(double_ulp(3, 5));
+    test_values<V>({-limits::denorm_min(), -limits::min(), -0x1p-30, -0.5, -1.5},
+                   {10000, -2, 0}, MAKE_TESTER_2(lgamma, lgamma_ref));
+    test_values<V>({-13.5, -30.5, -100.5, -1e6 - 0.5}, {10000, -200, -13},
+                   MAKE_TESTER_2(lgamma, lgamma_ref));
+    // lgamma has two zeros between each pair of poles in (-13, -2). Close to them
+    // the recurrence loses relative, but not absolute, precision.
+    test_values<V>({-2.5, -2.4570247382208006, -2.7476826467274127, -12.5}, {10000, -13, -2},
+                   [&](const V &x) {
+                       V totest = lgamma(x);
+                       V expect([&](auto i) { return lgamma_ref(x[i]); });
+                       // epilogue_load pads with zeros, where both are inf
+                       VERIFY(all_of(totest == expect
+                                     || abs(totest - expect)
+                                          <= 32 * limits::epsilon() * max(V(1), abs(expect))))
+                           << "x = " << x << ", totest = " << totest
+                           << ", expect = " << expect;
+                   });
+
+    vir::test::setFuzzyness<double>(double_ulp(3, 4));
+    test_values<V>({limits::denorm_min(), limits::min(), 0x1p-30, 0.5, 1.25, 1.5, 2.5, 12.5},
+                   {10000, 0, 13}, MAKE_TESTER_2(tgamma, tgamma_ref));
+    test_values<V>({13, 14, 30, 170, 171.5, limits::max()}, {10000, 13, 180},
+                   MAKE_TESTER_2(tgamma, tgamma_ref));
+    vir::test::setFuzzyness<double>(double_ulp(4, 5));
+    test_values<V>({-limits::denorm_min(), -limits::min(), -0x1p-30, -0.5, -1.5, -12.5},
+                   {10000, -13, 0}, MAKE_TESTER_2(tgamma, tgamma_ref));
+    test_values<V>({-13.5, -30.5, -170.5, -180.5}, {10000, -190, -13},
+                   MAKE_TESTER_2(tgamma, tgamma_ref));
 }
 
 TEST_TYPES(V, test1Arg, real_test_types)  //{{{1
@@ -523,13 +894,83 @@ TEST_TYPES(V, test1Arg, real_test_types)  //{{{1
                     limits::max(),
                     limits::min() / 3},
                    {10000, -limits::max() / 2, limits::max() / 2}, MAKE_TESTER(sqrt),
-                   MAKE_TESTER(erf), MAKE_TESTER(erfc), MAKE_TESTER(tgamma),
-                   MAKE_TESTER(lgamma), MAKE_TESTER(ceil), MAKE_TESTER(floor),
+                   MAKE_TESTER(ceil), MAKE_TESTER(floor),
                    MAKE_TESTER(trunc), MAKE_TESTER(round), MAKE_TESTER(lround),
                    MAKE_TESTER(llround), MAKE_TESTER(nearbyint), MAKE_TESTER(rint),
                    MAKE_TESTER(lrint), MAKE_TESTER(llrint), MAKE_TESTER(ilogb));
 }
 
+TEST_TYPES(V, integer_results, real_test_types)  //{{{1
+{
+    vir::test::setFuzzyness<float>(0);
+    vir::test::setFuzzyness<double>(0);
+
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    // lround rounds halfway values away from zero, lrint uses the current
+    // rounding mode (this test runs with each of them). The result for NaN and
+    // out-of-range inputs is unspecified; it has to match the C library anyway.
+    test_values<V>({0.5,
+                    -0.5,
+                    1.5,
+                    -1.5,
+                    2.5,
+                    -2.5,
+                    0x1.fffffep-2,
+                    -0x1.fffffep-2,
+                    0x1.fffffffffffffp-2,
+                    -0x1.fffffffffffffp-2,
+                    0x1.000002p-1,
+                    -0x1.000002p-1,
+                    0x1.000008p21,
+                    -0x1.000008p21,
+                    0x1.fffffep22,
+                    -0x1.fffffep22,
+                    0x1.0000000000001p51,
+                    -0x1.0000000000001p51,
+                    0x1.fffffffffffffp51,
+                    -0x1.fffffffffffffp51,
+                    0x1p31,
+                    -0x1p31,
+                    0x1.fffffep30,
+                    -0x1.fffffep30,
+                    0x1.fffffep62,
+                    -0x1.fffffep62,
+                    0x1.fffffffffffffp62,
+                    -0x1.fffffffffffffp62,
+                    0x1p63,
+                    -0x1p63,
+                    0x1p64,
+                    -0x1p64,
+                    limits::max(),
+                    -limits::max(),
+                    limits::infinity(),
+                    -limits::infinity(),
+                    limits::quiet_NaN(),
+                    -limits::quiet_NaN(),
+                    +0.,
+                    -0.,
+                    limits::denorm_min(),
+                    -limits::denorm_min()},
+                   {10000, -0x1p32, 0x1p32}, MAKE_TESTER(lround), MAKE_TESTER(llround),
+                   MAKE_TESTER(lrint), MAKE_TESTER(llrint));
+
+    test_values<V>({limits::quiet_NaN(), -limits::quiet_NaN(), limits::infinity(),
+                    -limits::infinity(), +0., -0., 1., -1., 0.75, 3., limits::denorm_min(),
+                    -limits::denorm_min(), 3 * limits::denorm_min(),
+                    limits::min() - limits::denorm_min(), limits::min() / 3,
+                    limits::min(), -limits::min(), limits::max(), -limits::max()},
+                   {10000, -limits::max(), limits::max()}, MAKE_TESTER(ilogb));
+    using IV = decltype(ilogb(V()));
+    COMPARE(ilogb(V(0)), IV(FP_ILOGB0));
+    COMPARE(ilogb(-V(0)), IV(FP_ILOGB0));
+    COMPARE(ilogb(V(limits::infinity())), IV(std::numeric_limits<int>::max()));
+    COMPARE(ilogb(V(-limits::infinity())), IV(std::numeric_limits<int>::max()));
+    COMPARE(ilogb(V(limits::quiet_NaN())), IV(FP_ILOGBNAN));
+    COMPARE(ilogb(V(limits::denorm_min())), IV(limits::min_exponent - limits::digits));
+    COMPARE(ilogb(V(limits::min() / 2)), IV(limits::min_exponent - 2));
+}
+
 TEST_TYPES(V, test2Arg, real_test_types)  //{{{1
 {
     using T = typename V::value_type;
@@ -576,6 +1017,112 @@ TEST_TYPES(V, test2Arg, real_test_types)  //{{{1
         MAKE_TESTER(islessgreater),
         MAKE_TESTER(isunordered)
         );
+
+    // finite, non-zero results; the exponents in the list are broadcast and
+    // thus also cover the repeated squaring and sqrt code paths
+    vir::test::setFuzzyness<float>(2);
+    vir::test::setFuzzyness<double>(2);
+    test_values_2arg<V>({0.25, 0.5, 0.75, 1.25, 1.5, 2, 3, 4, 7, 10, 0.1, -0.5, -1,
+                         -2, -3, -10},
+                        {10000, 0.25, 20}, MAKE_TESTER(pow));
+    VERIFY((sfinae_is_callable<typename V::value_type, V>(
+        [](auto a, auto b) -> decltype(pow(a, b)) { return {}; })));
+    VERIFY((sfinae_is_callable<V, typename V::value_type>(
+        [](auto a, auto b) -> decltype(pow(a, b)) { return {}; })));
+}
+
+TEST_TYPES(V, fmin_fmax_fdim, real_test_types)  //{{{1
+{
+    vir::test::setFuzzyness<float>(0);
+    vir::test::setFuzzyness<double>(0);
+
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    // NaN against numbers and NaN in either argument, both zeros, and infinities
+    // on either side of fdim
+    test_values_2arg<V>(
+        {limits::quiet_NaN(), -limits::quiet_NaN(), limits::infinity(),
+         -limits::infinity(), +0., -0., 1., -1., limits::denorm_min(),
+         -limits::denorm_min(), limits::min(), -limits::min(), limits::max(),
+         -limits::max(), limits::min() / 3},
+        {10000, -limits::max(), limits::max()}, MAKE_TESTER(fmin), MAKE_TESTER(fmax),
+        MAKE_TESTER(fdim), [](const V &x, const V &y) {
+            // == can't tell the zeros apart; fmin and fmax may return either
+            // zero, fdim must return +0
+            const V r = fdim(x, y);
+            COMPARE(signbit(r) && r == 0, typename V::mask_type(false))
+                << "fdim(" << x << ", " << y << ") = " << r;
+        });
+
+    const V nan = limits::quiet_NaN();
+    const V inf = limits::infinity();
+    const V x([](auto i) { return T(int(i) - 2); });
+    COMPARE(fmin(nan, x), x);
+    COMPARE(fmin(x, nan), x);
+    COMPARE(fmax(nan, x), x);
+    COMPARE(fmax(x, nan), x);
+    VERIFY(all_of(isnan(fmin(nan, nan))));
+    VERIFY(all_of(isnan(fmax(nan, nan))));
+    VERIFY(all_of(isnan(fdim(nan, x))));
+    VERIFY(all_of(isnan(fdim(x, nan))));
+    COMPARE(fdim(inf, x), inf);
+    COMPARE(fdim(x, -inf), inf);
+    COMPARE(fdim(inf, -inf), inf);
+    COMPARE(fdim(inf, inf), V(0));
+    COMPARE(fdim(-inf, x), V(0));
+    COMPARE(fdim(V(limits::max()), V(-limits::max())), inf);
+}
+
+TEST_TYPES(V, nextafter_copysign, real_test_types)  //{{{1
+{
+    vir::test::setFuzzyness<float>(0);
+    vir::test::setFuzzyness<double>(0);
+
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    // steps across zero, the denormal range, and to and from infinity
+    test_values_2arg<V>(
+        {limits::quiet_NaN(), -limits::quiet_NaN(), limits::infinity(),
+         -limits::infinity(), +0., -0., 1., -1., limits::denorm_min(),
+         -limits::denorm_min(), 2 * limits::denorm_min(), limits::min(),
+         -limits::min(), limits::min() - limits::denorm_min(), limits::max(),
+         -limits::max(), limits::min() / 3},
+        {10000, -limits::max(), limits::max()}, MAKE_TESTER(nextafter),
+        MAKE_TESTER(copysign), [](const V &x, const V &y) {
+            // == can't tell the zeros apart
+            const V r = nextafter(x, y);
+            const V ref([&](auto i) { return std::nextafter(x[i], y[i]); });
+            COMPARE(signbit(r) && r == 0, signbit(ref) && ref == 0)
+                << "nextafter(" << x << ", " << y << ") = " << r;
+            // copysign also sets the sign of NaN
+            const V r2 = copysign(x, y);
+            COMPARE(signbit(r2), signbit(y))
+                << "copysign(" << x << ", " << y << ") = " << r2;
+        });
+
+    const V zero = 0;
+    const V inf = limits::infinity();
+    const V dmin = limits::denorm_min();
+    COMPARE(nextafter(zero, inf), dmin);
+    COMPARE(nextafter(-zero, inf), dmin);
+    COMPARE(nextafter(zero, -inf), -dmin);
+    COMPARE(nextafter(dmin, -inf), zero);
+    VERIFY(none_of(signbit(nextafter(dmin, -inf))));
+    VERIFY(all_of(signbit(nextafter(-dmin, inf))));
+    VERIFY(all_of(signbit(nextafter(zero, -zero))));
+    COMPARE(nextafter(V(limits::min()), zero), V(limits::min() - limits::denorm_min()));
+    COMPARE(nextafter(V(limits::min() - limits::denorm_min()), inf), V(limits::min()));
+    COMPARE(nextafter(V(limits::max()), inf), inf);
+    COMPARE(nextafter(inf, zero), V(limits::max()));
+    COMPARE(nextafter(-inf, zero), V(-limits::max()));
+    COMPARE(nextafter(inf, inf), inf);
+    VERIFY(all_of(isnan(nextafter(V(limits::quiet_NaN()), zero))));
+    VERIFY(all_of(isnan(nextafter(zero, V(limits::quiet_NaN())))));
+    VERIFY(all_of(signbit(copysign(V(limits::quiet_NaN()), V(-1)))));
+    VERIFY(all_of(signbit(copysign(V(1), -zero))));
+    VERIFY(none_of(signbit(copysign(V(-1), V(limits::quiet_NaN())))));
+    VERIFY(all_of(signbit(copysign(V(1), V(-limits::quiet_NaN())))));
+    COMPARE(copysign(inf, V(-1)), -inf);
 }
 
 TEST_TYPES(V, hypot3_fma, real_test_types)  //{{{1
@@ -618,6 +1165,21 @@ TEST_TYPES(V, hypot3_fma, real_test_types)  //{{{1
         {10000, -limits::max()/2, limits::max()/2},
         MAKE_TESTER(fma)
         );
+    {
+        // x * y == 1 + 2^-h1 + 2^-h2 + 2^-digits is a tie for the sum with 1:
+        // z decides the rounding. Catches double rounding and a lost product
+        // error in fma emulations.
+        constexpr int h1 = limits::digits / 2;
+        constexpr int h2 = limits::digits - h1;
+        const T x = 1 + std::ldexp(T(1), -h1);
+        const T y = 1 + std::ldexp(T(1), -h2);
+        for (const T z : {T(), std::ldexp(T(1), -limits::digits - 40),
+                          -std::ldexp(T(1), -limits::digits - 40), T(-1),
+                          -(x * y)}) {
+            COMPARE(fma(V(x), V(y), V(z)), V(std::fma(x, y, z))) << "z = " << z;
+            COMPARE(fma(V(y), V(x), V(-z)), V(std::fma(y, x, -z))) << "z = " << -z;
+        }
+    }
     VERIFY((sfinae_is_callable<V, V, V>(
         [](auto a, auto b, auto c) -> decltype(hypot(a, b, c)) { return {}; })));
     VERIFY((sfinae_is_callable<T, T, V>(
@@ -670,7 +1232,8 @@ TEST_TYPES(V, ldexp_scalbn_scalbln_modf, real_test_types)  //{{{1
          -limits::min() / 3},
         {10000, -limits::max() / 2, limits::max() / 2},
         [](const V input) {
-            for (int exp : {-10000, -100, -10, -1, 0, 1, 10, 100, 10000}) {
+            for (int exp : {-10000, -2000, -1080, -1030, -160, -140, -100, -10, -1, 0, 1,
+                            10, 100, 140, 1030, 2000, 10000}) {
                 const auto totest = ldexp(input, exp);
                 using R = std::remove_const_t<decltype(totest)>;
                 auto &&expected = [&](const auto &v) -> const R {
@@ -691,7 +1254,8 @@ TEST_TYPES(V, ldexp_scalbn_scalbln_modf, real_test_types)  //{{{1
             }
         },
         [](const V input) {
-            for (int exp : {-10000, -100, -10, -1, 0, 1, 10, 100, 10000}) {
+            for (int exp : {-10000, -2000, -1080, -1030, -160, -140, -100, -10, -1, 0, 1,
+                            10, 100, 140, 1030, 2000, 10000}) {
                 const auto totest = scalbn(input, exp);
                 using R = std::remove_const_t<decltype(totest)>;
                 auto &&expected = [&](const auto &v) -> const R {
@@ -712,7 +1276,8 @@ TEST_TYPES(V, ldexp_scalbn_scalbln_modf, real_test_types)  //{{{1
             }
         },
         [](const V input) {
-            for (long exp : {-10000, -100, -10, -1, 0, 1, 10, 100, 10000}) {
+            for (long exp : {-10000, -2000, -1080, -1030, -160, -140, -100, -10, -1, 0, 1,
+                             10, 100, 140, 1030, 2000, 10000}) {
                 const auto totest = scalbln(input, exp);
                 using R = std::remove_const_t<decltype(totest)>;
                 auto &&expected = [&](const auto &v) -> const R {
@@ -765,35 +1330,75 @@ TEST_TYPES(V, remqo, real_test_types)  //{{{1
     vir::test::setFuzzyness<double>(0);
 
     using limits = std::numeric_limits<typename V::value_type>;
+    auto&& test_remquo = [](const V a, const V b) {
+        using IV = std::experimental::fixed_size_simd<int, V::size()>;
+        IV quo = {}; // the type is wrong, this should fail
+        const V totest = remquo(a, b, &quo);
+        auto &&expected = [&](const auto &v, const auto &w) -> std::pair<const V, const IV> {
+            std::pair<V, IV> tmp = {};
+            using std::remquo;
+            for (std::size_t i = 0; i < V::size(); ++i) {
+                int tmp2;
+                tmp.first[i] = remquo(v[i], w[i], &tmp2);
+                tmp.second[i] = tmp2;
+            }
+            return tmp;
+        };
+        const auto expect1 = expected(a, b);
+        COMPARE(isnan(totest), isnan(expect1.first))
+            << "remquo(" << a << ", " << b << ", quo) = " << totest << " != " << expect1.first;
+        const V clean_a = iif(isnan(totest), 0, a);
+        const V clean_b = iif(isnan(totest), 1, b);
+        const auto expect2 = expected(clean_a, clean_b);
+        COMPARE(remquo(clean_a, clean_b, &quo), expect2.first)
+            << "\nclean_a/b = " << clean_a << ", " << clean_b;
+        COMPARE(quo, expect2.second);
+    };
     test_values_2arg<V>(
         {limits::quiet_NaN(), limits::infinity(), -limits::infinity(), +0., -0.,
          limits::denorm_min(), limits::min(), limits::max(), limits::min() / 3},
-        {10000, -limits::max()/2, limits::max()/2},
-        [](const V a, const V b) {
-            using IV = std::experimental::fixed_size_simd<int, V::size()>;
-            IV quo = {}; // the type is wrong, this should fail
-            const V totest = remquo(a, b, &quo);
-            auto &&expected = [&](const auto &v, const auto &w) -> std::pair<const V, const IV> {
-                std::pair<V, IV> tmp = {};
-                using std::remquo;
-                for (std::size_t i = 0; i < V::size(); ++i) {
-                    int tmp2;
-                    tmp.first[i] = remquo(v[i], w[i], &tmp2);
-                    tmp.second[i] = tmp2;
-                }
-                return tmp;
-            };
-            const auto expect1 = expected(a, b);
-            COMPARE(isnan(totest), isnan(expect1.first))
-                << "remquo(" << a << ", " << b << ", quo) = " << totest << " != " << expect1.first;
-            const V clean_a = iif(isnan(totest), 0, a);
-            const V clean_b = iif(isnan(totest), 1, b);
-            const auto expect2 = expected(clean_a, clean_b);
-            COMPARE(remquo(clean_a, clean_b, &quo), expect2.first)
-                << "\nclean_a/b = " << clean_a << ", " << clean_b;
-            COMPARE(quo, expect2.second);
+        {10000, -limits::max()/2, limits::max()/2}, test_remquo);
+
+    // quotients that need more than one reduction step, and ties
+    test_values_2arg<V>(
+        {1, -1, 0.1, -3, 0.5, 1.5, 2.5, -3.5, 0x1.921fb6p2, 1e6, -3e9, 1e20,
+         1e30, limits::max(), -limits::max() / 3, limits::min(),
+         limits::denorm_min() * 3},
+        {10000, -1000, 1000}, test_remquo, MAKE_TESTER(fmod),
+        MAKE_TESTER(remainder));
+}
+
+TEST_TYPES(V, denormal_mode, real_test_types)  //{{{1
+{
+    using std::experimental::__proposed::denormal_mode;
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+    // the compiler doesn't know about the mode: read the inputs through volatile
+    // on every use so that it can neither evaluate the products at compile time
+    // nor reuse a product computed in a different mode
+    const auto unknown = [](T x) {
+        const volatile T y = x;
+        return V(T(y));
+    };
+    const T min = limits::min();
+    const T sub = limits::min() / 2;
+    COMPARE(unknown(min) * T(0.25), V(min / 4));
+    COMPARE(unknown(sub) * T(4), V(min * 2));
+#if defined __SSE2_MATH__ || defined __aarch64__
+    {
+        const denormal_mode ftz_daz;
+        COMPARE(unknown(min) * T(0.25), V(0));  // flush to zero
+        COMPARE(unknown(sub) * T(4), V(0));     // denormals are zero
+        VERIFY(all_of(unknown(sub) == 0));
+        {
+            const denormal_mode restore(false, false);
+            COMPARE(unknown(min) * T(0.25), V(min / 4));
         }
-    );
+        COMPARE(unknown(min) * T(0.25), V(0));
+    }
+#endif
+    COMPARE(unknown(min) * T(0.25), V(min / 4));
+    COMPARE(unknown(sub) * T(4), V(min * 2));
 }
 
 // TODO {{{1
@@ -1128,6 +1128,48 @@ TEST_TYPES(V, reductions, all_test_types)  //{{{1
     }
 }
 
+TEST_TYPES(V, compensated_reductions, real_test_types)  //{{{1
+{
+    using std::experimental::__proposed::compensated_plus;
+    using std::experimental::__proposed::compensated_accumulator;
+    using T = typename V::value_type;
+    using limits = std::numeric_limits<T>;
+
+    // the ones vanish in a plain sum next to ±2^digits
+    const T big = std::ldexp(T(1), limits::digits);
+    const V x([&](auto i) { return i == 0 ? big : i == V::size() - 1 ? -big : T(1); });
+    COMPARE(std::experimental::reduce(x, compensated_plus()),
+            V::size() == 1 ? big : T(V::size() - 2))
+        << "x: " << x;
+    COMPARE(reduce(where(x < big, x), T(), compensated_plus()),
+            V::size() == 1 ? T() : T(V::size() - 2) - big);
+
+    vir::test::setFuzzyness<float>(1);
+    vir::test::setFuzzyness<double>(1);
+    std::uniform_real_distribution<T> dist(-1, 1);
+    for (int repeat = 0; repeat < 100; ++repeat) {
+        const V y([&](int) { return std::ldexp(dist(g_mt_gen), int(g_mt_gen() % 40)); });
+        FUZZY_COMPARE(std::experimental::reduce(y, compensated_plus()), [y]() {
+            long double acc = 0;
+            for (size_t i = 0; i < V::size(); ++i) {
+                acc += y[i];
+            }
+            return T(acc);
+        }()) << "y: " << y;
+    }
+
+    // a plain sum would stay at 1
+    compensated_accumulator<V> acc;
+    acc += V(1);
+    compensated_accumulator<V> acc2;
+    for (int i = 0; i < 1000; ++i) {
+        (i % 2 ? acc : acc2) += V(limits::epsilon() / 4);
+    }
+    acc += acc2;
+    COMPARE(acc.sum(), V(1 + 250 * limits::epsilon()));
+    FUZZY_COMPARE(acc.reduce(), T(V::size()) + T(250 * V::size()) * limits::epsilon());
+}
+
 TEST_TYPES(V, algorithms, all_test_types)  //{{{1
 {
     using T = typename V::value_type;
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "unittest.h"
 #include "metahelpers.h"
 #include <cmath>    // abs & sqrt
+#include <cfenv>
 #include "test_values.h"
 
 template <class... Ts> using base_template = std::experimental::simd<Ts...>;
@@ -90,3 +91,106 @@ TEST_TYPES(V, legendre, real_test_types)  //{{{1
         });
 }
 
+// libstdc++'s Bessel functions throw for many arguments if not rounding to nearest.
+// The simd Bessel functions build on sincos and exp. Their argument reductions
+// (trunc and round) don't depend on the rounding mode, but the error bounds below
+// only hold when rounding to nearest. Thus both are evaluated via to_nearest.
+TEST_TYPES(V, cyl_bessel, real_test_types)  //{{{1
+{
+    using T = typename V::value_type;
+    using L = long double;
+    using limits = std::numeric_limits<T>;
+    vir::test::setFuzzyness<float>(1);
+    vir::test::setFuzzyness<double>(6);
+    test_values<V>(
+        {limits::quiet_NaN(), +0., -0., 1, 2, 4, 5, 8, 100},
+        {10000, 0, 100}, [](const V &x) {
+            // J_ν oscillates; close to its zeros the error is only small relative to
+            // the envelope min(1, √(2/(πx)))
+            V envelope = 1;
+            where(x > T(0.63661977236758134), envelope) = sqrt(T(0.63661977236758134) / x);
+            const V nus[] = {V(0), V(1), V([](auto i) { return T(i & 1); })};
+            for (const V &nu : nus) {
+                V totest = to_nearest([&]() { return cyl_bessel_j(nu, x); });
+                V expect = to_nearest([&]() {
+                    return V([&](auto i) { return T(std::cyl_bessel_j(L(nu[i]), L(x[i]))); });
+                });
+                nan_cleanup(totest, expect);
+                VERIFY(all_of(abs(totest - expect) <= 4 * limits::epsilon() * envelope))
+                    << "nu = " << nu << ", x = " << x << ", totest = " << totest
+                    << ", expect = " << expect;
+            }
+            // other orders call the scalar implementation
+            V totest = to_nearest([&]() { return cyl_bessel_j(V(2), x); });
+            V expect = to_nearest([&]() {
+                return V([&](auto i) { return std::cyl_bessel_j(T(2), x[i]); });
+            });
+            nan_cleanup(totest, expect);
+            COMPARE(totest, expect) << "x = " << x;
+        });
+    test_values<V>(
+        {limits::quiet_NaN(), +0., -0., 1, 8, 90, 100, 1000, 10000},
+        {10000, 0, 700}, [](const V &x) {
+            const V nus[] = {V(0), V(1), V([](auto i) { return T(i & 1); })};
+            for (const V &nu : nus) {
+                V totest = to_nearest([&]() { return cyl_bessel_i(nu, x); });
+                V expect = to_nearest([&]() {
+                    return V([&](auto i) { return T(std::cyl_bessel_i(L(nu[i]), L(x[i]))); });
+                });
+                nan_cleanup(totest, expect);
+                FUZZY_COMPARE(totest, expect) << "nu = " << nu << ", x = " << x;
+            }
+        });
+}
+
+// E(k) via the arithmetic-geometric mean in long double. libstdc++'s
+// comp_ellint_2 is off by up to 17 double ulp even in long double.
+template <class T> T comp_ellint_2_agm(T k)
+{
+    using L = long double;
+    if (std::isnan(k)) {
+        return k;
+    } else if (std::abs(k) == 1) {
+        return 1;
+    }
+    L a = 1, b = std::sqrt(1 - L(k) * L(k)), c = k, p = 0.5L;
+    L sum = p * c * c;
+    // converges quadratically; a and b may not become equal in the directed
+    // rounding modes, thus no test for c == 0
+    for (int i = 0; i < 16; ++i) {
+        const L a_next = (a + b) / 2;
+        c = (a - b) / 2;
+        b = std::sqrt(a * b);
+        a = a_next;
+        p *= 2;
+        sum += p * c * c;
+    }
+    return T(3.14159265358979323846264338327950288L / (2 * a) * (1 - sum));
+}
+
+TEST_TYPES(V, comp_ellint, real_test_types)  //{{{1
+{
+    using T = typename V::value_type;
+    using L = long double;
+    using limits = std::numeric_limits<T>;
+    const bool nearest = std::fegetround() == FE_TONEAREST;
+    vir::test::setFuzzyness<float>(1);
+    vir::test::setFuzzyness<double>(nearest ? 3 : 6);
+    test_values<V>(
+        {limits::quiet_NaN(), +0., -0., 1, -1, 0.5, -0.5, 0.999, -0.999},
+        {10000, -0.999, 0.999}, [](const V &k) {
+            V totest = comp_ellint_1(k);
+            V expect([&](auto i) { return T(std::comp_ellint_1(L(k[i]))); });
+            nan_cleanup(totest, expect);
+            FUZZY_COMPARE(totest, expect) << "k = " << k;
+        });
+    vir::test::setFuzzyness<double>(nearest ? 5 : 15);
+    test_values<V>(
+        {limits::quiet_NaN(), +0., -0., 1, -1, 0.5, -0.5, 0.999, -0.999},
+        {10000, -0.999, 0.999}, [](const V &k) {
+            V totest = comp_ellint_2(k);
+            V expect([&](auto i) { return comp_ellint_2_agm(k[i]); });
+            nan_cleanup(totest, expect);
+            FUZZY_COMPARE(totest, expect) << "k = " << k;
+        });
+}
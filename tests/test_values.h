@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include <experimental/simd>
+#include <cfenv>
 #include <initializer_list>
 #include <random>
 
@@ -57,6 +58,17 @@ void test_values(const std::initializer_list<typename V::value_type> &inputs,
     [](auto...) {}((fun_pack(epilogue_load<V>(inputs.begin(), inputs.size())), 0)...);
 }
 
+// Evaluates fun() with the rounding mode set to round to nearest.
+template <class F> auto to_nearest(F &&fun)
+{
+    const int mode = std::fegetround();
+    std::fesetround(FE_TONEAREST);
+    auto r = fun();
+    asm("" : "+m"(r));  // GCC may otherwise move the FP operations past fesetround
+    std::fesetround(mode);
+    return r;
+}
+
 template <class V> struct RandomValues {
     const std::size_t count;
     const typename V::value_type min;